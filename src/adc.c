@@ -1,13 +1,85 @@
 #include <stdint.h>
+#include <stdbool.h>
 #include <stm32f4xx.h>
 #include <stm32f4xx_ll_gpio.h>
 
 #include "error.h"
 #include "adc.h"
 #include "dma.h"
+#include "irq.h"
+#include "capture.h"
+#include "analog.h"
+#include "health.h"
+#include "settings.h"
+#include "tim.h"
+
+/*
+ * The matrix is scanned back to back for ADC_FAST_WINDOW_MS after the
+ * last sign of a key (a change, or a key held down).  After that each
+ * pass is followed by a pause of ADC_SLOW_PAUSE_MS with the columns
+ * released, counted down by ADC_Tick from SysTick, and the CPU sleeps.
+ * The first pass that sees a key goes straight back to full rate.
+ */
+#define ADC_FAST_WINDOW_MS 1000
+#define ADC_SLOW_PAUSE_MS  8
+
+/*
+ * Optionally each column is converted ADC_Oversample times, the DMA
+ * interrupt restarting the sequence and summing it, and the average
+ * run through a one pole IIR filter with a gain of 1/2^ADC_FilterShift.
+ * Both work on pairs of channels at once with the halfword SIMD
+ * instructions; 8 sums of 12 bits still fit a halfword.  The filter
+ * keeps its state scaled by 2^ADC_FilterShift, which also fits, so
+ * that the fraction is not lost on every pass and the output settles
+ * on the input, rounded, whichever direction it comes from.  There is
+ * no halfword shift: a pair is shifted as a word and the bits the
+ * upper sample pushes into the lower one masked off.
+ */
+typedef union {
+  int16_t sample[12];
+  uint32_t pair[6];
+} ADC_SamplesTypeDef;
 
 static uint8_t ADC_Column;
-static int16_t ADC_Readback_Buffer[12];
+static ADC_SamplesTypeDef ADC_Readback;
+static ADC_SamplesTypeDef ADC_Sum;
+static ADC_SamplesTypeDef ADC_FilterState[14];
+static ADC_SamplesTypeDef ADC_Filtered;
+static uint16_t ADC_FilterSeeded;
+static uint8_t ADC_Oversample = 1, ADC_OversampleShift, ADC_FilterShift;
+static uint8_t ADC_Repeat;
+static volatile uint8_t ADC_NewOversampleShift, ADC_NewFilterShift;
+static volatile bool ADC_FilterPending;
+
+/*
+ * TIM5 starts the conversions of a column ADC_Dwell ticks after
+ * ADC_Start has driven it and set up the ADC.  ADC_Calibrate measures,
+ * for each column, the shortest dwell after which the readings match
+ * those after ADC_SETTLE_MAX_TICKS, coming from the column before as
+ * in a full rate scan.  It runs at boot, and again from the main loop
+ * once the LED supplies are up and loading the board.
+ */
+#define ADC_SETTLE_MAX_TICKS     1344  /* 16 us */
+#define ADC_SETTLE_MIN_TICKS     84    /* 1 us, never less */
+#define ADC_SETTLE_MARGIN_TICKS  42    /* on top of half again */
+#define ADC_SETTLE_STEP_TICKS    21    /* resolution of the search */
+#define ADC_SETTLE_REPEATS       8
+#define ADC_SETTLE_TOLERANCE     8     /* ADC counts, on top of the noise */
+#define ADC_SETTLE_NOISE_MAX     64    /* ADC counts, range of a quiet column */
+
+static uint16_t ADC_Dwell[14];
+static volatile bool ADC_Calibrating;
+static volatile bool ADC_Halt, ADC_Running, ADC_Paused;
+static uint16_t ADC_PreviousMask[14];
+static uint32_t ADC_LastActivity;
+static uint8_t ADC_PauseLeft;
+
+static volatile bool ADC_Fast = true;
+static volatile uint32_t ADC_Passes;
+static uint32_t ADC_RatePasses;
+static uint16_t ADC_RateTime;
+static uint16_t ADC_ScanRate;
+static uint32_t ADC_FastTime, ADC_SlowTime;
 
 int16_t ADC_ExtraChannels[14];
 
@@ -27,24 +99,191 @@ static uint8_t ADC_ExtraChannelMux[14] = {
   2, 2, 3, 3,
 };
 
-void HAL_ADC_ConvCpltCallback(ADC_HandleTypeDef* hadc)
+/* Average the conversions of a column into ADC_Readback and filter
+   that into ADC_Filtered, which it returns; returns NULL, after
+   starting the next sequence, while more conversions are due */
+static RAMFUNC const int16_t *ADC_Filter(void)
+{
+  uint32_t *state = ADC_FilterState[ADC_Column].pair;
+  uint32_t half, mask;
+  int i;
+
+  if (ADC_Oversample > 1) {
+    for (i = 0; i < 6; i++)
+      ADC_Sum.pair[i] = ADC_Repeat? __SADD16(ADC_Sum.pair[i], ADC_Readback.pair[i]) : ADC_Readback.pair[i];
+    if (++ADC_Repeat < ADC_Oversample) {
+      TIM_TriggerADC(0);
+      return NULL;
+    }
+    ADC_Repeat = 0;
+    for (i = 0; i < 12; i++)
+      ADC_Readback.sample[i] = ADC_Sum.sample[i] >> ADC_OversampleShift;
+  }
+
+  if (!ADC_FilterShift)
+    return ADC_Readback.sample;
+
+  half = 0x00010001u << (ADC_FilterShift - 1);
+  mask = 0x00010001u * (0xffffu >> ADC_FilterShift);
+  if (!(ADC_FilterSeeded & (1 << ADC_Column))) {
+    ADC_FilterSeeded |= 1 << ADC_Column;
+    for (i = 0; i < 6; i++)
+      state[i] = ADC_Readback.pair[i] << ADC_FilterShift;
+  }
+  for (i = 0; i < 6; i++) {
+    /* s += x - y, with y = s / 2^k rounded to the nearest */
+    uint32_t s = state[i];
+    uint32_t y = (__UADD16(s, half) >> ADC_FilterShift) & mask;
+    s = __SADD16(__SSUB16(s, y), ADC_Readback.pair[i]);
+    state[i] = s;
+    ADC_Filtered.pair[i] = (__UADD16(s, half) >> ADC_FilterShift) & mask;
+  }
+  return ADC_Filtered.sample;
+}
+
+RAMFUNC void HAL_ADC_ConvCpltCallback(ADC_HandleTypeDef* hadc)
 {
   int i;
   uint16_t mask = 0;
-  int16_t cutoff = ADC_Readback_Buffer[0];
-  ADC_ExtraChannels[ADC_Column] = ADC_Readback_Buffer[11];
-  for (i=2; i<11; i++) {
-    mask >>= 1;
-    if (ADC_Readback_Buffer[i] < cutoff)
-      mask |= (1<<8);
+  int16_t cutoff;
+  const int16_t *sample;
+
+  if (ADC_Calibrating) {
+    ADC_Running = false;
+    return;
+  }
+  sample = ADC_Filter();
+  if (!sample)
+    return;
+  cutoff = sample[0];
+  ADC_ExtraChannels[ADC_Column] = sample[11];
+  if (ANALOG_Active)
+    mask = ANALOG_ColumnMask(ADC_Column, sample);
+  else {
+    for (i=2; i<11; i++) {
+      mask >>= 1;
+      if (sample[i] < cutoff)
+        mask |= (1<<8);
+    }
   }
   unsigned next_col = ADC_Column + 1;
   if (next_col >= 14)
     next_col = 0;
+  if (mask | ADC_PreviousMask[ADC_Column])
+    ADC_LastActivity = HAL_GetTick();
+  HEALTH_Column(ADC_Column, mask, ADC_PreviousMask[ADC_Column], sample);
+  ADC_PreviousMask[ADC_Column] = mask;
+  /* Before the IIR filter, which a replay can apply itself */
+  CAPTURE_Record(ADC_Passes, ADC_Column, mask, ADC_Readback.sample);
   ADC_MaskCallback(ADC_Column, mask);
+  if (!next_col) {
+    ADC_Passes++;
+    if (ADC_FilterPending) {
+      ADC_OversampleShift = ADC_NewOversampleShift;
+      ADC_Oversample = 1 << ADC_OversampleShift;
+      ADC_FilterShift = ADC_NewFilterShift;
+      ADC_FilterSeeded = 0;
+      ADC_FilterPending = false;
+    }
+    if (ADC_Halt) {
+      ADC_Running = false;
+      return;
+    }
+    ADC_Fast = (HAL_GetTick() - ADC_LastActivity < ADC_FAST_WINDOW_MS);
+    if (!ADC_Fast) {
+      GPIOD->ODR = 0xffff;
+      ADC_PauseLeft = ADC_SLOW_PAUSE_MS;
+      ADC_Paused = true;
+      ADC_Running = false;
+      return;
+    }
+  }
   ADC_Start(next_col);
 }
 
+/* Called from SysTick: restarts a paused scan and keeps the scan
+   rate statistics */
+void ADC_Tick(void)
+{
+  if (ADC_Fast)
+    ADC_FastTime++;
+  else
+    ADC_SlowTime++;
+  if (++ADC_RateTime >= 1000) {
+    uint32_t passes = ADC_Passes;
+    ADC_ScanRate = passes - ADC_RatePasses;
+    ADC_RatePasses = passes;
+    ADC_RateTime = 0;
+  }
+
+  if (ADC_Paused && !ADC_Halt && !--ADC_PauseLeft)
+    ADC_Start(0);
+}
+
+/* Full matrix passes in the last second */
+uint16_t ADC_GetScanRate(void)
+{
+  return ADC_ScanRate;
+}
+
+bool ADC_IsFastScan(void)
+{
+  return ADC_Fast;
+}
+
+/* Time in ms spent scanning at full rate and with pauses */
+uint32_t ADC_GetScanResidency(bool fast)
+{
+  return fast? ADC_FastTime : ADC_SlowTime;
+}
+
+/* Apply the stored oversampling and filter; SETTINGS_Load must have
+   run first */
+void ADC_Load(void)
+{
+  uint8_t config[2];
+
+  if (SETTINGS_Get(SETTINGS_ID_ADC_FILTER, config, sizeof(config)))
+    ADC_ConfigureFilter(1 << config[0], config[1]);
+}
+
+/* May be called from an interrupt; takes effect from the next pass.
+   Oversample is 1, 2, 4 or 8 conversions per column, shift 0 (no
+   filter) to ADC_FILTER_SHIFT_MAX. */
+bool ADC_ConfigureFilter(unsigned oversample, unsigned shift)
+{
+  unsigned log2 = __builtin_ctz(oversample | 16);
+  uint8_t config[2] = { log2, shift };
+
+  if (oversample != 1u << log2 || log2 > 3 || shift > ADC_FILTER_SHIFT_MAX)
+    return false;
+  ADC_NewOversampleShift = log2;
+  ADC_NewFilterShift = shift;
+  ADC_FilterPending = true;
+  SETTINGS_Set(SETTINGS_ID_ADC_FILTER, config, sizeof(config));
+  return true;
+}
+
+/* Stop the scan at the end of the current pass, and wait for it */
+void ADC_Stop(void)
+{
+  ADC_Halt = true;
+  while (ADC_Running)
+    ;
+  GPIOD->ODR = 0xffff;
+}
+
+/* Restart a stopped scan from column 0 */
+void ADC_Resume(void)
+{
+  uint32_t basepri = IRQ_Lock(IRQ_PRIO_SYSTICK);
+
+  ADC_Halt = false;
+  if (!ADC_Running)
+    ADC_Start(0);
+  IRQ_Unlock(basepri);
+}
+
 void HAL_ADC_MspInit(ADC_HandleTypeDef* hadc)
 {
   GPIO_InitTypeDef GPIO_InitStruct;
@@ -91,6 +330,8 @@ extern void ADC_Setup_ADC(void)
   ADC_HandleStruct.Init.ContinuousConvMode = DISABLE;
   ADC_HandleStruct.Init.NbrOfConversion = 12;
   ADC_HandleStruct.Init.DMAContinuousRequests = ENABLE;
+  ADC_HandleStruct.Init.ExternalTrigConv = ADC_EXTERNALTRIGCONV_T5_CC1;
+  ADC_HandleStruct.Init.ExternalTrigConvEdge = ADC_EXTERNALTRIGCONVEDGE_RISING;
   CHECK_HAL_RESULT(HAL_ADC_Init(&ADC_HandleStruct));
 
   ADC_ChannelConfigStruct.Channel = ADC_CHANNEL_0;
@@ -145,11 +386,13 @@ extern void ADC_Setup_ADC(void)
   CHECK_HAL_RESULT(HAL_ADC_ConfigChannel(&ADC_HandleStruct, &ADC_ChannelConfigStruct));
 }
 
-extern void ADC_Start(uint8_t column)
+RAMFUNC void ADC_Start(uint8_t column)
 {
   ADC_ChannelConfTypeDef ADC_ChannelConfigStruct;
 
   ADC_Column = column;
+  ADC_Paused = false;
+  ADC_Running = true;
 
   GPIOD->ODR = ~(GPIO_PIN_2 << column);
   LL_GPIO_ResetOutputPin(GPIOA, LL_GPIO_PIN_9);
@@ -162,5 +405,147 @@ extern void ADC_Start(uint8_t column)
   ADC_ChannelConfigStruct.SamplingTime = ADC_SAMPLETIME_15CYCLES;
   ADC_ChannelConfigStruct.Offset = 0;
   HAL_ADC_ConfigChannel(&ADC_HandleStruct, &ADC_ChannelConfigStruct);
-  HAL_ADC_Start_DMA(&ADC_HandleStruct, (uint32_t *)ADC_Readback_Buffer, 12);
+  HAL_ADC_Start_DMA(&ADC_HandleStruct, ADC_Readback.pair, 12);
+  TIM_TriggerADC(ADC_Dwell[column]);
+}
+
+/* Convert a column dwell ticks after switching to it from the one
+   before, which has had the longest dwell; adds the readings to sum
+   and, if given, keeps their range */
+static void ADC_CalibrationPass(uint8_t column, uint16_t dwell, int32_t *sum, int16_t *lo, int16_t *hi)
+{
+  unsigned i, previous = column? column - 1 : 13;
+  uint16_t saved = ADC_Dwell[previous];
+
+  ADC_Dwell[previous] = ADC_SETTLE_MAX_TICKS;
+  ADC_Start(previous);
+  while (ADC_Running)
+    ;
+  ADC_Dwell[previous] = saved;
+  ADC_Dwell[column] = dwell;
+  ADC_Start(column);
+  while (ADC_Running)
+    ;
+  for (i = 0; i < 11; i++) {
+    int16_t v = ADC_Readback.sample[i];
+    sum[i] += v;
+    if (lo && v < lo[i])
+      lo[i] = v;
+    if (hi && v > hi[i])
+      hi[i] = v;
+  }
+}
+
+/* Whether the readings after dwell ticks stay within the noise of the
+   settled ones on the reference and every key channel */
+static bool ADC_CalibrationStable(uint8_t column, uint16_t dwell, const int32_t *settled,
+                                  const int16_t *lo, const int16_t *hi)
+{
+  int32_t sum[11] = { 0 };
+  unsigned rep, i;
+
+  for (rep = 0; rep < ADC_SETTLE_REPEATS; rep++)
+    ADC_CalibrationPass(column, dwell, sum, NULL, NULL);
+  for (i = 0; i < 11; i++) {
+    int32_t limit = (hi[i] - lo[i] + ADC_SETTLE_TOLERANCE) * ADC_SETTLE_REPEATS;
+    int32_t diff = sum[i] - settled[i];
+    if (i != 1 && (diff > limit || diff < -limit))   /* 1 is not used */
+      return false;
+  }
+  return true;
+}
+
+/* Find the shortest safe dwell of a column by bisection between
+   ADC_SETTLE_MAX_TICKS, taken as stable, and the longest dwell seen
+   to be unstable, starting from none.  The result is half again that
+   unstable dwell plus ADC_SETTLE_MARGIN_TICKS, and at least
+   ADC_SETTLE_MIN_TICKS.  A column with a key down, which loads the
+   line differently from the released state the dwell must cover, or
+   too noisy to tell, gets ADC_SETTLE_MAX_TICKS. */
+static uint16_t ADC_CalibrateColumn(uint8_t column)
+{
+  int32_t settled[11] = { 0 };
+  int16_t lo[11], hi[11];
+  uint16_t stable = ADC_SETTLE_MAX_TICKS, unstable = 0;
+  uint32_t dwell;
+  unsigned rep, i;
+
+  for (i = 0; i < 11; i++) {
+    lo[i] = INT16_MAX;
+    hi[i] = INT16_MIN;
+  }
+  for (rep = 0; rep < ADC_SETTLE_REPEATS; rep++)
+    ADC_CalibrationPass(column, ADC_SETTLE_MAX_TICKS, settled, lo, hi);
+  for (i = 0; i < 11; i++) {
+    if (i != 1 && hi[i] - lo[i] > ADC_SETTLE_NOISE_MAX)
+      return ADC_SETTLE_MAX_TICKS;
+    if (i >= 2 && settled[i] < settled[0])   /* as the key scan sees it */
+      return ADC_SETTLE_MAX_TICKS;
+  }
+
+  if (ADC_CalibrationStable(column, 0, settled, lo, hi))
+    return ADC_SETTLE_MIN_TICKS;
+  while (stable - unstable > ADC_SETTLE_STEP_TICKS) {
+    uint16_t middle = (stable + unstable) / 2;
+    if (ADC_CalibrationStable(column, middle, settled, lo, hi))
+      stable = middle;
+    else
+      unstable = middle;
+  }
+  dwell = unstable + unstable / 2 + ADC_SETTLE_MARGIN_TICKS;
+  if (dwell < ADC_SETTLE_MIN_TICKS)
+    dwell = ADC_SETTLE_MIN_TICKS;
+  if (dwell > ADC_SETTLE_MAX_TICKS)
+    dwell = ADC_SETTLE_MAX_TICKS;
+  return dwell;
+}
+
+/* Calibrate every column at boot, before the scan starts */
+void ADC_Calibrate(void)
+{
+  unsigned column;
+
+  ADC_Calibrating = true;
+  for (column = 0; column < 14; column++)
+    ADC_Dwell[column] = ADC_CalibrateColumn(column);
+  ADC_Calibrating = false;
+  GPIOD->ODR = 0xffff;
+}
+
+/* Called from the main loop once the LED supplies are on, to measure
+   again under their load: one column per call, each taking a few ms,
+   and only in the pause of a slow scan, so that no key can be down
+   and the scan is only held up while it would idle anyway.  Returns
+   true once every column is done. */
+bool ADC_RecalibrateStep(void)
+{
+  static uint8_t column;
+
+  if (column >= 14)
+    return true;
+  if (ADC_Fast)
+    return false;
+  ADC_Stop();
+  /* A pass cut short by ADC_Stop does not update ADC_Fast */
+  if (HAL_GetTick() - ADC_LastActivity >= ADC_FAST_WINDOW_MS) {
+    ADC_Calibrating = true;
+    ADC_Dwell[column] = ADC_CalibrateColumn(column);
+    ADC_Calibrating = false;
+    GPIOD->ODR = 0xffff;
+    column++;
+  }
+  ADC_Resume();
+  return column >= 14;
+}
+
+/* Key mask the scan last derived for a column */
+uint16_t ADC_GetKeyMask(uint8_t column)
+{
+  return column < 14? ADC_PreviousMask[column] : 0;
+}
+
+/* Dwell of a column, in TIM5 ticks */
+uint16_t ADC_GetDwell(uint8_t column)
+{
+  return column < 14? ADC_Dwell[column] : 0;
 }
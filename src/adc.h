@@ -1,7 +1,20 @@
 extern void ADC_Setup_ADC(void);
 extern void ADC_Start(uint8_t column);
+extern void ADC_Load(void);
+extern void ADC_Calibrate(void);
+extern bool ADC_RecalibrateStep(void);
+extern uint16_t ADC_GetDwell(uint8_t column);
+extern bool ADC_ConfigureFilter(unsigned oversample, unsigned shift);
+extern void ADC_Stop(void);
+extern void ADC_Resume(void);
+extern void ADC_Tick(void);
+extern uint16_t ADC_GetScanRate(void);
+extern bool ADC_IsFastScan(void);
+extern uint32_t ADC_GetScanResidency(bool fast);
 extern void ADC_MaskCallback(uint8_t column, uint16_t mask);
+extern uint16_t ADC_GetKeyMask(uint8_t column);
 extern int16_t ADC_ExtraChannels[14];
+#define ADC_FILTER_SHIFT_MAX  3
 #define ADC_EXTRACHANNEL_11   3
 #define ADC_EXTRACHANNEL_12   4
 #define ADC_EXTRACHANNEL_13   5
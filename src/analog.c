@@ -0,0 +1,124 @@
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stm32f4xx.h>
+
+#include "key.h"
+#include "settings.h"
+#include "analog.h"
+#include "irq.h"
+#include "adc.h"
+
+/*
+ * Rapid trigger.  Instead of comparing each sample with the column's
+ * reference, every key's travel, reference minus sample, is followed
+ * from pass to pass.  A key goes down once it has moved the
+ * sensitivity past its last turning point towards the bottom, and is
+ * past its own actuation depth; it goes up once it has moved the
+ * sensitivity back from its deepest point.  A key can so be pressed
+ * again without first rising above a fixed threshold.
+ *
+ * ANALOG_ColumnMask runs in the scan interrupt for every column.  It
+ * is written to compile to conditional instructions rather than
+ * branches: one pass over nine keys is a few hundred cycles, small
+ * next to the conversion time of a column.
+ */
+
+static int16_t Analog_Actuation[14][9];  /* travel for a press, per key */
+static int16_t Analog_Extreme[14][9];    /* last turning point */
+static uint16_t Analog_Mask[14];
+static int16_t Analog_Sensitivity;
+volatile bool ANALOG_Active;
+
+static uint8_t Analog_Upload[ANALOG_CONFIG_SIZE];
+static volatile uint16_t Analog_CommitLength;
+static volatile bool Analog_CommitPending;
+
+static bool Analog_Valid(const uint8_t *config, unsigned len)
+{
+	return len == 0 ||
+		(len == ANALOG_CONFIG_SIZE && !(config[0] & ~ANALOG_FLAG_RAPID_TRIGGER) && config[1]);
+}
+
+/* Apply the stored configuration; SETTINGS_Load must have run first */
+void ANALOG_Load(void)
+{
+	uint8_t config[ANALOG_CONFIG_SIZE];
+	uint32_t basepri;
+	unsigned kc, column;
+
+	ANALOG_Active = false;
+	if (!SETTINGS_Get(SETTINGS_ID_ANALOG, config, sizeof(config)) ||
+	    !Analog_Valid(config, sizeof(config)) ||
+	    !(config[0] & ANALOG_FLAG_RAPID_TRIGGER))
+		return;
+
+	Analog_Sensitivity = config[1];
+	for (kc = 0; kc <= KEY_CODE_MAX; kc++)
+		if ((kc & 0xf) < 14)
+			Analog_Actuation[kc & 0xf][kc >> 4] = config[2 + kc] * ANALOG_DEPTH_UNIT + 1;
+
+	/* Start from whatever the scan last saw, so held keys stay down.
+	   Their turning points start at the top and follow the keys
+	   from the next pass on. */
+	basepri = IRQ_Lock(IRQ_PRIO_SCAN);
+	memset(Analog_Extreme, 0, sizeof(Analog_Extreme));
+	for (column = 0; column < 14; column++)
+		Analog_Mask[column] = ADC_GetKeyMask(column);
+	ANALOG_Active = true;
+	IRQ_Unlock(basepri);
+}
+
+/* Called from the scan interrupt with the conversions of a column,
+   as laid out in ADC_Readback_Buffer; returns the key mask */
+RAMFUNC uint16_t ANALOG_ColumnMask(uint8_t column, const int16_t *sample)
+{
+	const int16_t *actuation = Analog_Actuation[column];
+	int16_t *extreme = Analog_Extreme[column];
+	int32_t reference = sample[0], sensitivity = Analog_Sensitivity;
+	uint32_t mask = Analog_Mask[column];
+	unsigned i;
+
+	for (i = 0; i < 9; i++) {
+		int32_t travel = reference - sample[2 + i];
+		uint32_t down = (mask >> i) & 1;
+		/* Movement away from the turning point: deeper while up,
+		   shallower while down */
+		int32_t moved = down? extreme[i] - travel : travel - extreme[i];
+		uint32_t flip = (moved >= sensitivity) & (down | (travel >= actuation[i]));
+
+		if (moved < 0 || flip)
+			extreme[i] = travel;
+		mask ^= flip << i;
+	}
+	Analog_Mask[column] = mask;
+	return mask;
+}
+
+bool ANALOG_Write(unsigned offset, const uint8_t *data, unsigned len)
+{
+	if (Analog_CommitPending || offset + len > sizeof(Analog_Upload))
+		return false;
+	memcpy(Analog_Upload + offset, data, len);
+	return true;
+}
+
+/* A length of 0 goes back to the plain threshold */
+bool ANALOG_Commit(unsigned len)
+{
+	if (Analog_CommitPending || !Analog_Valid(Analog_Upload, len))
+		return false;
+	Analog_CommitLength = len;
+	Analog_CommitPending = true;
+	return true;
+}
+
+/* Called from the main loop */
+void ANALOG_Service(void)
+{
+	if (!Analog_CommitPending)
+		return;
+	SETTINGS_Set(SETTINGS_ID_ANALOG, Analog_Upload, Analog_CommitLength);
+	ANALOG_Load();
+	Analog_CommitPending = false;
+}
@@ -0,0 +1,14 @@
+/* Uploaded configuration: flags, sensitivity in ADC counts, then the
+   actuation depth of every key code in units of ANALOG_DEPTH_UNIT
+   counts past the reference */
+#define ANALOG_FLAG_RAPID_TRIGGER  0x01
+#define ANALOG_DEPTH_UNIT          8
+#define ANALOG_CONFIG_SIZE         (2 + KEY_CODE_MAX + 1)
+
+extern volatile bool ANALOG_Active;
+
+extern void ANALOG_Load(void);
+extern uint16_t ANALOG_ColumnMask(uint8_t column, const int16_t *sample);
+extern bool ANALOG_Write(unsigned offset, const uint8_t *data, unsigned len);
+extern bool ANALOG_Commit(unsigned len);
+extern void ANALOG_Service(void);
@@ -0,0 +1,89 @@
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stm32f4xx.h>
+
+#include "capture.h"
+#include "irq.h"
+
+/*
+ * Diagnostic capture of the raw key sensor samples.  The ADC
+ * interrupt copies the conversions of selected columns into a ring of
+ * records, and the USB SOF interrupt moves them out to the capture
+ * endpoint, two per 1 ms frame.  That is 2000 columns a second, well
+ * short of a full rate scan, so the host picks every how many passes
+ * and which columns to capture; whatever still does not fit is
+ * dropped and counted, both in the next record and in total.
+ *
+ * The ring has one producer (the scan) and one consumer (SOF), so
+ * it needs no locking.
+ */
+
+#define CAPTURE_RING_SIZE  64   /* power of two */
+
+_Static_assert(sizeof(CAPTURE_RecordTypeDef) == 32, "capture records are 32 bytes");
+
+static CAPTURE_RecordTypeDef Capture_Ring[CAPTURE_RING_SIZE];
+static volatile uint8_t Capture_Head, Capture_Tail;
+static volatile uint16_t Capture_Every;   /* 0 when off */
+static volatile uint16_t Capture_Columns;
+static uint8_t Capture_Dropped;
+static volatile uint32_t Capture_DroppedTotal;
+
+/* Capture the columns in the mask on every nth pass, or stop if
+   every is 0 */
+bool CAPTURE_Configure(unsigned every, unsigned columns)
+{
+	if (columns >= 1u << 14)
+		return false;
+	Capture_Every = 0;
+	Capture_Tail = Capture_Head;
+	Capture_Columns = columns;
+	Capture_Every = every;
+	return true;
+}
+
+/* Called from the scan interrupt for every column */
+RAMFUNC void CAPTURE_Record(uint32_t pass, uint8_t column, uint16_t mask, const int16_t *sample)
+{
+	unsigned every = Capture_Every;
+	uint8_t head = Capture_Head;
+	CAPTURE_RecordTypeDef *rec;
+
+	if (!every || !(Capture_Columns & (1 << column)) || pass % every)
+		return;
+	if ((uint8_t)(head - Capture_Tail) >= CAPTURE_RING_SIZE) {
+		if (Capture_Dropped < 0xff)
+			Capture_Dropped++;
+		Capture_DroppedTotal++;
+		return;
+	}
+	rec = &Capture_Ring[head % CAPTURE_RING_SIZE];
+	rec->pass = pass;
+	rec->mask = mask;
+	rec->column = column;
+	rec->dropped = Capture_Dropped;
+	memcpy(rec->sample, sample, sizeof(rec->sample));
+	Capture_Dropped = 0;
+	Capture_Head = head + 1;
+}
+
+/* Called from SOF: copies up to CAPTURE_RECORDS_PER_PACKET records
+   into packet, returning the length */
+RAMFUNC unsigned CAPTURE_Fill(void *packet)
+{
+	CAPTURE_RecordTypeDef *out = packet;
+	uint8_t tail = Capture_Tail;
+	unsigned n = 0;
+
+	while (n < CAPTURE_RECORDS_PER_PACKET && tail != Capture_Head)
+		out[n++] = Capture_Ring[tail++ % CAPTURE_RING_SIZE];
+	Capture_Tail = tail;
+	return n * sizeof(*out);
+}
+
+/* Records dropped since reset for want of room in the ring */
+uint32_t CAPTURE_GetDropped(void)
+{
+	return Capture_DroppedTotal;
+}
@@ -0,0 +1,17 @@
+/* Raw samples of one column, as streamed on the capture endpoint; two
+   to a packet, little endian */
+typedef struct {
+	uint32_t pass;      /* scan pass number */
+	uint16_t mask;      /* key mask the firmware derived from sample */
+	uint8_t column;
+	uint8_t dropped;    /* records lost just before this one, saturating */
+	int16_t sample[12]; /* ADC_Readback, in conversion order: averaged
+	                       when oversampling, before the IIR filter */
+} CAPTURE_RecordTypeDef;
+
+#define CAPTURE_RECORDS_PER_PACKET  2
+
+extern bool CAPTURE_Configure(unsigned every, unsigned columns);
+extern void CAPTURE_Record(uint32_t pass, uint8_t column, uint16_t mask, const int16_t *sample);
+extern unsigned CAPTURE_Fill(void *packet);
+extern uint32_t CAPTURE_GetDropped(void);
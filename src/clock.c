@@ -0,0 +1,178 @@
+#include <stdint.h>
+#include <stdbool.h>
+#include <stm32f4xx.h>
+
+#include "clock.h"
+#include "led.h"
+#include "irq.h"
+
+/*
+ * The PLL is left alone, so the 48 MHz USB clock is unaffected; only
+ * the AHB and APB prescalers change.  At the idle level HCLK is
+ * halved (the USB core needs at least 14.2 MHz) and APB1 goes from
+ * /2 to /1, so PCLK1, and with it SPI2, stays at 42 MHz while every
+ * timer kernel clock, on APB1 and APB2 alike, is halved.
+ *
+ * The LED supply PWMs and the TIM10 refresh run off those timers, so
+ * their periods, compare values and the TIM1 dead time are halved to
+ * keep the same frequencies and duty cycles.  The full speed values
+ * are saved and restored exactly, since some periods are odd.  The
+ * encoder (TIM3) only counts edges; its input filter just gets twice
+ * as long.
+ *
+ * The ADC keeps its sample and conversion cycle counts, so at the
+ * idle level the matrix is scanned at half rate with sampling
+ * windows twice as long; settling only gets better, and so does the
+ * column dwell counted by TIM5, which is left alone too.
+ */
+
+#define CLOCK_IDLE_DELAY_MS 2000
+
+static TIM_TypeDef * const CLOCK_Timers[] = { TIM1, TIM2, TIM4, TIM9, TIM10, TIM11 };
+static const uint8_t CLOCK_TimerChannels[] = { 4, 4, 4, 2, 1, 1 };
+#define CLOCK_TIMER_COUNT (sizeof(CLOCK_Timers) / sizeof(CLOCK_Timers[0]))
+
+static uint32_t CLOCK_SavedARR[CLOCK_TIMER_COUNT];
+static uint32_t CLOCK_SavedCCR[CLOCK_TIMER_COUNT][4];
+static uint32_t CLOCK_SavedBDTR;
+
+static unsigned CLOCK_Level = CLOCK_LEVEL_FULL;
+static uint32_t CLOCK_LastBusy;
+static uint32_t CLOCK_LevelSince;
+static uint32_t CLOCK_Residency[CLOCK_LEVEL_COUNT];
+static uint32_t CLOCK_LoadSince, CLOCK_LoadCycles;
+static uint16_t CLOCK_Load;
+
+static volatile uint32_t *CLOCK_CCR(TIM_TypeDef *tim, unsigned channel)
+{
+	return &(&tim->CCR1)[channel];
+}
+
+static void CLOCK_HalveTimers(void)
+{
+	unsigned i, ch;
+
+	for (i = 0; i < CLOCK_TIMER_COUNT; i++) {
+		TIM_TypeDef *tim = CLOCK_Timers[i];
+		/* Let the new values take effect at the next update event */
+		tim->CR1 |= TIM_CR1_ARPE;
+		CLOCK_SavedARR[i] = tim->ARR;
+		tim->ARR = (CLOCK_SavedARR[i] + 1) / 2 - 1;
+		for (ch = 0; ch < CLOCK_TimerChannels[i]; ch++) {
+			CLOCK_SavedCCR[i][ch] = *CLOCK_CCR(tim, ch);
+			*CLOCK_CCR(tim, ch) = (CLOCK_SavedCCR[i][ch] + 1) / 2;
+		}
+	}
+	/* Round the dead time up, never down */
+	CLOCK_SavedBDTR = TIM1->BDTR;
+	TIM1->BDTR = (CLOCK_SavedBDTR & ~TIM_BDTR_DTG) |
+		(((CLOCK_SavedBDTR & TIM_BDTR_DTG) + 1) / 2);
+}
+
+static void CLOCK_RestoreTimers(void)
+{
+	unsigned i, ch;
+
+	for (i = 0; i < CLOCK_TIMER_COUNT; i++) {
+		TIM_TypeDef *tim = CLOCK_Timers[i];
+		tim->ARR = CLOCK_SavedARR[i];
+		for (ch = 0; ch < CLOCK_TimerChannels[i]; ch++)
+			*CLOCK_CCR(tim, ch) = CLOCK_SavedCCR[i][ch];
+	}
+	TIM1->BDTR = CLOCK_SavedBDTR;
+}
+
+void CLOCK_SetLevel(unsigned level)
+{
+	uint32_t now = HAL_GetTick();
+	uint32_t basepri;
+
+	if (level == CLOCK_Level || level >= CLOCK_LEVEL_COUNT)
+		return;
+
+	/* The LED refresh interrupt also writes TIM10->CR1 */
+	basepri = IRQ_Lock(IRQ_PRIO_LED);
+
+	/* The prescalers are changed in an order which never takes
+	   PCLK1 above its 42 MHz limit */
+	if (level == CLOCK_LEVEL_IDLE) {
+		CLOCK_HalveTimers();
+		MODIFY_REG(RCC->CFGR, RCC_CFGR_HPRE, RCC_SYSCLK_DIV2);
+		MODIFY_REG(RCC->CFGR, RCC_CFGR_PPRE1, RCC_HCLK_DIV1);
+	} else {
+		MODIFY_REG(RCC->CFGR, RCC_CFGR_PPRE1, RCC_HCLK_DIV2);
+		MODIFY_REG(RCC->CFGR, RCC_CFGR_HPRE, RCC_SYSCLK_DIV1);
+		CLOCK_RestoreTimers();
+	}
+	SystemCoreClockUpdate();
+
+	/* Keep SysTick at 1 ms */
+	SysTick->LOAD = SystemCoreClock / 1000 - 1;
+	SysTick->VAL = 0;
+	IRQ_Unlock(basepri);
+
+	CLOCK_Residency[CLOCK_Level] += now - CLOCK_LevelSince;
+	CLOCK_LevelSince = now;
+	CLOCK_Level = level;
+}
+
+unsigned CLOCK_GetLevel(void)
+{
+	return CLOCK_Level;
+}
+
+/* Time in ms spent at each level, for estimating power draw */
+uint32_t CLOCK_GetResidency(unsigned level)
+{
+	uint32_t t;
+
+	if (level >= CLOCK_LEVEL_COUNT)
+		return 0;
+	t = CLOCK_Residency[level];
+	if (level == CLOCK_Level)
+		t += HAL_GetTick() - CLOCK_LevelSince;
+	return t;
+}
+
+/* Called from the main loop; busy when keys are active or an effect
+   is being rendered */
+void CLOCK_Governor(bool busy)
+{
+	uint32_t now = HAL_GetTick();
+
+	if (busy || !LED_IsStarted()) {
+		CLOCK_LastBusy = now;
+		CLOCK_SetLevel(CLOCK_LEVEL_FULL);
+	} else if (now - CLOCK_LastBusy >= CLOCK_IDLE_DELAY_MS)
+		CLOCK_SetLevel(CLOCK_LEVEL_IDLE);
+}
+
+/* Sleep until the next interrupt.  The cycle counter stops while the
+   core sleeps (unless a debugger has set DBGMCU_CR_DBG_SLEEP), so over
+   a second it counts the cycles spent in handlers and the main loop. */
+void CLOCK_Sleep(void)
+{
+	uint32_t now = HAL_GetTick();
+
+	if (!(DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk)) {
+		CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+		DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+		CLOCK_LoadSince = now;
+		CLOCK_LoadCycles = DWT->CYCCNT;
+	} else if (now - CLOCK_LoadSince >= 1000) {
+		uint32_t cycles = DWT->CYCCNT;
+		uint32_t total = SystemCoreClock / 1000 * (now - CLOCK_LoadSince);
+		uint32_t load = (uint64_t)(cycles - CLOCK_LoadCycles) * 1000 / total;
+
+		CLOCK_Load = load < 1000? load : 1000;
+		CLOCK_LoadSince = now;
+		CLOCK_LoadCycles = cycles;
+	}
+	__WFI();
+}
+
+/* CPU load over the last second, in 0.1 % units */
+unsigned CLOCK_GetLoad(void)
+{
+	return CLOCK_Load;
+}
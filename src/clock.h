@@ -0,0 +1,12 @@
+enum {
+	CLOCK_LEVEL_FULL,  /* HCLK 84 MHz */
+	CLOCK_LEVEL_IDLE,  /* HCLK 42 MHz */
+	CLOCK_LEVEL_COUNT
+};
+
+extern void CLOCK_Governor(bool busy);
+extern void CLOCK_SetLevel(unsigned level);
+extern unsigned CLOCK_GetLevel(void);
+extern uint32_t CLOCK_GetResidency(unsigned level);
+extern void CLOCK_Sleep(void);
+extern unsigned CLOCK_GetLoad(void);
@@ -3,6 +3,7 @@
 
 #include "error.h"
 #include "dma.h"
+#include "irq.h"
 
 DMA_HandleTypeDef DMA_HandleStruct_SPI2RX;
 DMA_HandleTypeDef DMA_HandleStruct_SPI2TX;
@@ -11,25 +12,31 @@ DMA_HandleTypeDef DMA_HandleStruct_ADC;
 /**
 * @brief This function handles DMA1 Stream 3 interrupts (SPI 2 RX)
 */
-void DMA1_Stream3_IRQHandler(void)
+RAMFUNC void DMA1_Stream3_IRQHandler(void)
 {
+	IRQ_PROFILE_ENTER();
 	HAL_DMA_IRQHandler(&DMA_HandleStruct_SPI2RX);
+	IRQ_PROFILE_EXIT(IRQ_SRC_LED_DMA);
 }
 
 /**
 * @brief This function handles DMA1 Stream 4 interrupts (SPI 2 TX)
 */
-void DMA1_Stream4_IRQHandler(void)
+RAMFUNC void DMA1_Stream4_IRQHandler(void)
 {
+	IRQ_PROFILE_ENTER();
 	HAL_DMA_IRQHandler(&DMA_HandleStruct_SPI2TX);
+	IRQ_PROFILE_EXIT(IRQ_SRC_LED_DMA);
 }
 
 /**
 * @brief This function handles DMA2 Stream 0 interrupts (ADC)
 */
-void DMA2_Stream0_IRQHandler(void)
+RAMFUNC void DMA2_Stream0_IRQHandler(void)
 {
+	IRQ_PROFILE_ENTER();
 	HAL_DMA_IRQHandler(&DMA_HandleStruct_ADC);
+	IRQ_PROFILE_EXIT(IRQ_SRC_SCAN);
 }
 
 
@@ -43,12 +50,12 @@ void DMA_Setup(void)
 
 	/* Stream 3 */
 
-	HAL_NVIC_SetPriority(DMA1_Stream3_IRQn, 0, 0);
+	HAL_NVIC_SetPriority(DMA1_Stream3_IRQn, IRQ_PRIO_LED, 0);
 	HAL_NVIC_EnableIRQ(DMA1_Stream3_IRQn);
 
 	/* Stream 4 */
 
-	HAL_NVIC_SetPriority(DMA1_Stream4_IRQn, 0, 0);
+	HAL_NVIC_SetPriority(DMA1_Stream4_IRQn, IRQ_PRIO_LED, 0);
 	HAL_NVIC_EnableIRQ(DMA1_Stream4_IRQn);
 
 	/* DMA 2 */
@@ -57,6 +64,6 @@ void DMA_Setup(void)
 
 	/* Stream 0 */
 
-	HAL_NVIC_SetPriority(DMA2_Stream0_IRQn, 0, 0);
+	HAL_NVIC_SetPriority(DMA2_Stream0_IRQn, IRQ_PRIO_SCAN, 0);
 	HAL_NVIC_EnableIRQ(DMA2_Stream0_IRQn);
 }
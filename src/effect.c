@@ -1,51 +1,30 @@
 #include <stdint.h>
+#include <stdbool.h>
 #include <stddef.h>
 
 #include "effect.h"
 #include "led.h"
+#include "key.h"
+#include "layout.h"
 
-static const uint8_t LedX[LED_ID_MAX+1] = {
-  0xe9,0xe9,0xf5,0xd9,0xfd,0xfd,0xfd,0xfd,0xf5,0xe9,0xe9,0xde,0xde,0xde,0xd4,0xd4,
-  0x64,0x5e,0x59,0x53,0x4e,0x48,0x43,0x4f,0x00,0x78,0x86,0x84,0x7a,0x74,0x6f,0x69,
-  0xbb,0xbb,0xc6,0x00,0x02,0x02,0x02,0x02,0x02,0x02,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x02,0x38,0x2d,0x23,0x3d,0x33,0x28,0x1d,0x0c,0x0e,0x0b,0x0b,0x02,0x19,0x18,0x27,
-  0x1f,0x02,0x0a,0x0a,0x15,0x1a,0x1f,0x25,0x2a,0x30,0x35,0x3b,0x40,0x40,0x35,0x2a,
-  0x5b,0x51,0x4b,0x46,0x51,0x56,0x5b,0x61,0x66,0x6c,0x71,0x7f,0x77,0x7c,0x71,0x66,
-  0x87,0x92,0x8a,0x93,0x95,0x99,0xa1,0xb0,0xc7,0xc6,0xbf,0xbb,0xb7,0xaf,0xb0,0xa0,
-  0xb0,0xa2,0x98,0x8d,0x82,0x82,0x8d,0x9d,0xb0,0xbb,0xc6,0xd4,0xd4,0xde,0xc6,0xbb,
-  0xe9,0xf5,0xfd,0xfd,0xfd,0xfe,0xf4,0xf4,0xfe,0xe6,0xde,0xd6,0x00,0xd6,0xde,0xe6,
-};
-
-static const uint8_t LedY[LED_ID_MAX+1] = {
-  0xcf,0xf6,0xe1,0xf6,0x9d,0xc5,0xb1,0xd9,0x90,0x7e,0xa5,0x7e,0xa5,0xcf,0xa5,0xcf,
-  0xcf,0xa5,0xcf,0xa5,0xcf,0xa5,0xcf,0xf6,0x00,0xf6,0xf6,0xcf,0xcf,0xa5,0xcf,0xa5,
-  0xcf,0xf6,0xf6,0x00,0xd9,0xc8,0xb6,0xa5,0x71,0x83,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x94,0xcf,0xcf,0xcf,0xa5,0xa5,0xa5,0xa5,0x7e,0xa5,0xcf,0xf6,0xea,0xf6,0xcf,0xf6,
-  0x1d,0x60,0x1d,0x58,0x58,0x7e,0x58,0x7e,0x58,0x7e,0x58,0x7e,0x58,0x1d,0x1d,0x1d,
-  0x1d,0x1d,0x58,0x7e,0x7e,0x58,0x7e,0x58,0x7e,0x58,0x7e,0xa5,0x58,0x7e,0x1d,0x1d,
-  0x7e,0x7e,0xa5,0xf6,0xa5,0xcf,0xf6,0xf6,0xa5,0x7e,0xa5,0x7e,0xa5,0xa5,0x7e,0x90,
-  0x1d,0x1d,0x1d,0x1d,0x1d,0x58,0x58,0x58,0x58,0x58,0x58,0x7e,0x58,0x58,0x1d,0x1d,
-  0x58,0x58,0x60,0x74,0x88,0x27,0x27,0x05,0x05,0x15,0x15,0x15,0x00,0x26,0x26,0x26,
+/* 512-512*cos(2*pi*p/1024) in 1/64 units, sampled every 8 steps
+   for p = -8 .. 264 (one quarter wave plus a guard point at each end) */
+static const uint16_t WaveTab[35] = {
+  0x0027, 0x0000, 0x0027, 0x009e, 0x0163, 0x0276, 0x03d6, 0x0583,
+  0x077b, 0x09be, 0x0c4a, 0x0f1d, 0x1236, 0x1592, 0x1930, 0x1d0e,
+  0x2129, 0x257e, 0x2a0a, 0x2ecc, 0x33c0, 0x38e3, 0x3e32, 0x43a9,
+  0x4946, 0x4f04, 0x54e1, 0x5ad8, 0x60e6, 0x6707, 0x6d38, 0x7374,
+  0x79b8, 0x8000, 0x8648,
 };
 
 uint8_t EFFECT_GetLedX(uint8_t id)
 {
-  return id <= LED_ID_MAX? LedX[id] : 0;
+  return id <= LED_ID_MAX? LAYOUT_Leds[id].x : 0;
 }
 
 uint8_t EFFECT_GetLedY(uint8_t id)
 {
-  return id <= LED_ID_MAX? LedY[id] : 0;
-}
-
-const uint8_t *EFFECT_GetLedColumnXs(unsigned column)
-{
-  return column <= LED_COLUMN_MAX? &LedX[column<<4] : NULL;
-}
-
-const uint8_t *EFFECT_GetLedColumnYs(unsigned column)
-{
-  return column <= LED_COLUMN_MAX? &LedY[column<<4] : NULL;
+  return id <= LED_ID_MAX? LAYOUT_Leds[id].y : 0;
 }
 
 void EFFECT_Solid(void *buf, uint8_t r, uint8_t g, uint8_t b)
@@ -64,7 +43,46 @@ void EFFECT_Solid(void *buf, uint8_t r, uint8_t g, uint8_t b)
 void EFFECT_Set_LED_Gradient(uint8_t id, void *context)
 {
   if (id <= LED_ID_MAX) {
-    uint8_t x = LedX[id], y = LedY[id];
+    uint8_t x = LAYOUT_Leds[id].x, y = LAYOUT_Leds[id].y;
     LED_Set_LED_RGB(id, y, x, 255-x);
   }
 }
+
+/* Quadratic interpolation through the three nearest samples;
+   the result matches round(512-512*cos(2*pi*p/1024)) exactly */
+static unsigned EFFECT_QuarterWave(unsigned phase)
+{
+  const uint16_t *t = &WaveTab[(phase >> 3) + 1];
+  int a = t[-1], b = t[0], c = t[1];
+  int f = phase & 7;
+  int num = b * 128 + f * 8 * (c - a) + f * f * (a - 2 * b + c);
+  return (num + 4096) >> 13;
+}
+
+/* Raised cosine, period 1024, range 0-1024 */
+unsigned EFFECT_Wave(unsigned phase)
+{
+  phase &= 1023;
+  if (phase > 512)
+    phase = 1024 - phase;
+  if (phase > 256)
+    return 1024 - EFFECT_QuarterWave(512 - phase);
+  else
+    return EFFECT_QuarterWave(phase);
+}
+
+/* Fully saturated colour wheel, 255 steps per sextant starting at red */
+uint32_t EFFECT_HueToRGB(unsigned hue)
+{
+  unsigned f;
+  hue %= EFFECT_HUE_PERIOD;
+  f = hue % 255;
+  switch (hue / 255) {
+  case 0:  return EFFECT_RGB(255, f, 0);
+  case 1:  return EFFECT_RGB(255-f, 255, 0);
+  case 2:  return EFFECT_RGB(0, 255, f);
+  case 3:  return EFFECT_RGB(0, 255-f, 255);
+  case 4:  return EFFECT_RGB(f, 0, 255);
+  default: return EFFECT_RGB(255, 0, 255-f);
+  }
+}
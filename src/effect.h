@@ -1,8 +1,24 @@
 extern uint8_t EFFECT_GetLedX(uint8_t id);
 extern uint8_t EFFECT_GetLedY(uint8_t id);
-extern const uint8_t *EFFECT_GetLedColumnXs(unsigned column);
-extern const uint8_t *EFFECT_GetLedColumnYs(unsigned column);
 extern void EFFECT_Solid(void *buf, uint8_t r, uint8_t g, uint8_t b);
 extern void EFFECT_Set_LED_Gradient(uint8_t id, void *context);
 
+#define EFFECT_RGB(r, g, b)  (((uint32_t)(r) << 16) | ((g) << 8) | (b))
+#define EFFECT_RGB_R(rgb)    ((uint8_t)((rgb) >> 16))
+#define EFFECT_RGB_G(rgb)    ((uint8_t)((rgb) >> 8))
+#define EFFECT_RGB_B(rgb)    ((uint8_t)(rgb))
+#define EFFECT_HUE_PERIOD    (6*255)
+extern unsigned EFFECT_Wave(unsigned phase);
+extern uint32_t EFFECT_HueToRGB(unsigned hue);
+
 extern void EFFECT_Rainbow(void *buf, uint32_t travel);
+
+extern void EFFECT_SpectrumReport(const uint8_t *report);
+extern bool EFFECT_SpectrumActive(void);
+extern void EFFECT_Spectrum(void *buf, uint32_t delay);
+
+extern void EFFECT_VM_Load(void);
+extern void EFFECT_VM_Service(void);
+extern bool EFFECT_VM_Write(unsigned offset, const uint8_t *data, unsigned len);
+extern bool EFFECT_VM_Commit(unsigned len);
+extern bool EFFECT_Program(void *buf, uint32_t delay);
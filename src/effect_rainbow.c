@@ -1,909 +1,28 @@
 #include <stdint.h>
+#include <stdbool.h>
 
 #include "effect.h"
 #include "led.h"
+#include "key.h"
+#include "layout.h"
 
-static const uint16_t sintab[] = {
- 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
- 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002,
- 0x0002, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0005, 0x0005,
- 0x0006, 0x0006, 0x0007, 0x0007, 0x0008, 0x0008, 0x0009, 0x0009,
- 0x000a, 0x000a, 0x000b, 0x000c, 0x000c, 0x000d, 0x000e, 0x000f,
- 0x000f, 0x0010, 0x0011, 0x0012, 0x0013, 0x0013, 0x0014, 0x0015,
- 0x0016, 0x0017, 0x0018, 0x0019, 0x001a, 0x001b, 0x001c, 0x001d,
- 0x001e, 0x001f, 0x0020, 0x0021, 0x0022, 0x0023, 0x0025, 0x0026,
- 0x0027, 0x0028, 0x0029, 0x002b, 0x002c, 0x002d, 0x002f, 0x0030,
- 0x0031, 0x0033, 0x0034, 0x0035, 0x0037, 0x0038, 0x003a, 0x003b,
- 0x003c, 0x003e, 0x003f, 0x0041, 0x0043, 0x0044, 0x0046, 0x0047,
- 0x0049, 0x004a, 0x004c, 0x004e, 0x004f, 0x0051, 0x0053, 0x0055,
- 0x0056, 0x0058, 0x005a, 0x005c, 0x005d, 0x005f, 0x0061, 0x0063,
- 0x0065, 0x0067, 0x0069, 0x006a, 0x006c, 0x006e, 0x0070, 0x0072,
- 0x0074, 0x0076, 0x0078, 0x007a, 0x007c, 0x007e, 0x0080, 0x0083,
- 0x0085, 0x0087, 0x0089, 0x008b, 0x008d, 0x008f, 0x0092, 0x0094,
- 0x0096, 0x0098, 0x009a, 0x009d, 0x009f, 0x00a1, 0x00a4, 0x00a6,
- 0x00a8, 0x00aa, 0x00ad, 0x00af, 0x00b2, 0x00b4, 0x00b6, 0x00b9,
- 0x00bb, 0x00be, 0x00c0, 0x00c3, 0x00c5, 0x00c7, 0x00ca, 0x00cc,
- 0x00cf, 0x00d2, 0x00d4, 0x00d7, 0x00d9, 0x00dc, 0x00de, 0x00e1,
- 0x00e4, 0x00e6, 0x00e9, 0x00eb, 0x00ee, 0x00f1, 0x00f3, 0x00f6,
- 0x00f9, 0x00fb, 0x00fe, 0x0101, 0x0104, 0x0106, 0x0109, 0x010c,
- 0x010f, 0x0111, 0x0114, 0x0117, 0x011a, 0x011d, 0x011f, 0x0122,
- 0x0125, 0x0128, 0x012b, 0x012e, 0x0131, 0x0133, 0x0136, 0x0139,
- 0x013c, 0x013f, 0x0142, 0x0145, 0x0148, 0x014b, 0x014e, 0x0151,
- 0x0154, 0x0156, 0x0159, 0x015c, 0x015f, 0x0162, 0x0165, 0x0168,
- 0x016b, 0x016e, 0x0171, 0x0174, 0x0177, 0x017a, 0x017e, 0x0181,
- 0x0184, 0x0187, 0x018a, 0x018d, 0x0190, 0x0193, 0x0196, 0x0199,
- 0x019c, 0x019f, 0x01a2, 0x01a5, 0x01a8, 0x01ac, 0x01af, 0x01b2,
- 0x01b5, 0x01b8, 0x01bb, 0x01be, 0x01c1, 0x01c4, 0x01c8, 0x01cb,
- 0x01ce, 0x01d1, 0x01d4, 0x01d7, 0x01da, 0x01dd, 0x01e1, 0x01e4,
- 0x01e7, 0x01ea, 0x01ed, 0x01f0, 0x01f3, 0x01f7, 0x01fa, 0x01fd,
- 0x0200, 0x0203, 0x0206, 0x0209, 0x020d, 0x0210, 0x0213, 0x0216,
- 0x0219, 0x021c, 0x021f, 0x0223, 0x0226, 0x0229, 0x022c, 0x022f,
- 0x0232, 0x0235, 0x0238, 0x023c, 0x023f, 0x0242, 0x0245, 0x0248,
- 0x024b, 0x024e, 0x0251, 0x0254, 0x0258, 0x025b, 0x025e, 0x0261,
- 0x0264, 0x0267, 0x026a, 0x026d, 0x0270, 0x0273, 0x0276, 0x0279,
- 0x027c, 0x027f, 0x0282, 0x0286, 0x0289, 0x028c, 0x028f, 0x0292,
- 0x0295, 0x0298, 0x029b, 0x029e, 0x02a1, 0x02a4, 0x02a7, 0x02aa,
- 0x02ac, 0x02af, 0x02b2, 0x02b5, 0x02b8, 0x02bb, 0x02be, 0x02c1,
- 0x02c4, 0x02c7, 0x02ca, 0x02cd, 0x02cf, 0x02d2, 0x02d5, 0x02d8,
- 0x02db, 0x02de, 0x02e1, 0x02e3, 0x02e6, 0x02e9, 0x02ec, 0x02ef,
- 0x02f1, 0x02f4, 0x02f7, 0x02fa, 0x02fc, 0x02ff, 0x0302, 0x0305,
- 0x0307, 0x030a, 0x030d, 0x030f, 0x0312, 0x0315, 0x0317, 0x031a,
- 0x031c, 0x031f, 0x0322, 0x0324, 0x0327, 0x0329, 0x032c, 0x032e,
- 0x0331, 0x0334, 0x0336, 0x0339, 0x033b, 0x033d, 0x0340, 0x0342,
- 0x0345, 0x0347, 0x034a, 0x034c, 0x034e, 0x0351, 0x0353, 0x0356,
- 0x0358, 0x035a, 0x035c, 0x035f, 0x0361, 0x0363, 0x0366, 0x0368,
- 0x036a, 0x036c, 0x036e, 0x0371, 0x0373, 0x0375, 0x0377, 0x0379,
- 0x037b, 0x037d, 0x0380, 0x0382, 0x0384, 0x0386, 0x0388, 0x038a,
- 0x038c, 0x038e, 0x0390, 0x0392, 0x0394, 0x0396, 0x0397, 0x0399,
- 0x039b, 0x039d, 0x039f, 0x03a1, 0x03a3, 0x03a4, 0x03a6, 0x03a8,
- 0x03aa, 0x03ab, 0x03ad, 0x03af, 0x03b1, 0x03b2, 0x03b4, 0x03b6,
- 0x03b7, 0x03b9, 0x03ba, 0x03bc, 0x03bd, 0x03bf, 0x03c1, 0x03c2,
- 0x03c4, 0x03c5, 0x03c6, 0x03c8, 0x03c9, 0x03cb, 0x03cc, 0x03cd,
- 0x03cf, 0x03d0, 0x03d1, 0x03d3, 0x03d4, 0x03d5, 0x03d7, 0x03d8,
- 0x03d9, 0x03da, 0x03db, 0x03dd, 0x03de, 0x03df, 0x03e0, 0x03e1,
- 0x03e2, 0x03e3, 0x03e4, 0x03e5, 0x03e6, 0x03e7, 0x03e8, 0x03e9,
- 0x03ea, 0x03eb, 0x03ec, 0x03ed, 0x03ed, 0x03ee, 0x03ef, 0x03f0,
- 0x03f1, 0x03f1, 0x03f2, 0x03f3, 0x03f4, 0x03f4, 0x03f5, 0x03f6,
- 0x03f6, 0x03f7, 0x03f7, 0x03f8, 0x03f8, 0x03f9, 0x03f9, 0x03fa,
- 0x03fa, 0x03fb, 0x03fb, 0x03fc, 0x03fc, 0x03fd, 0x03fd, 0x03fd,
- 0x03fe, 0x03fe, 0x03fe, 0x03fe, 0x03ff, 0x03ff, 0x03ff, 0x03ff,
- 0x03ff, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400,
- 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400, 0x0400,
- 0x03ff, 0x03ff, 0x03ff, 0x03ff, 0x03ff, 0x03fe, 0x03fe, 0x03fe,
- 0x03fe, 0x03fd, 0x03fd, 0x03fd, 0x03fc, 0x03fc, 0x03fb, 0x03fb,
- 0x03fa, 0x03fa, 0x03f9, 0x03f9, 0x03f8, 0x03f8, 0x03f7, 0x03f7,
- 0x03f6, 0x03f6, 0x03f5, 0x03f4, 0x03f4, 0x03f3, 0x03f2, 0x03f1,
- 0x03f1, 0x03f0, 0x03ef, 0x03ee, 0x03ed, 0x03ed, 0x03ec, 0x03eb,
- 0x03ea, 0x03e9, 0x03e8, 0x03e7, 0x03e6, 0x03e5, 0x03e4, 0x03e3,
- 0x03e2, 0x03e1, 0x03e0, 0x03df, 0x03de, 0x03dd, 0x03db, 0x03da,
- 0x03d9, 0x03d8, 0x03d7, 0x03d5, 0x03d4, 0x03d3, 0x03d1, 0x03d0,
- 0x03cf, 0x03cd, 0x03cc, 0x03cb, 0x03c9, 0x03c8, 0x03c6, 0x03c5,
- 0x03c4, 0x03c2, 0x03c1, 0x03bf, 0x03bd, 0x03bc, 0x03ba, 0x03b9,
- 0x03b7, 0x03b6, 0x03b4, 0x03b2, 0x03b1, 0x03af, 0x03ad, 0x03ab,
- 0x03aa, 0x03a8, 0x03a6, 0x03a4, 0x03a3, 0x03a1, 0x039f, 0x039d,
- 0x039b, 0x0399, 0x0397, 0x0396, 0x0394, 0x0392, 0x0390, 0x038e,
- 0x038c, 0x038a, 0x0388, 0x0386, 0x0384, 0x0382, 0x0380, 0x037d,
- 0x037b, 0x0379, 0x0377, 0x0375, 0x0373, 0x0371, 0x036e, 0x036c,
- 0x036a, 0x0368, 0x0366, 0x0363, 0x0361, 0x035f, 0x035c, 0x035a,
- 0x0358, 0x0356, 0x0353, 0x0351, 0x034e, 0x034c, 0x034a, 0x0347,
- 0x0345, 0x0342, 0x0340, 0x033d, 0x033b, 0x0339, 0x0336, 0x0334,
- 0x0331, 0x032e, 0x032c, 0x0329, 0x0327, 0x0324, 0x0322, 0x031f,
- 0x031c, 0x031a, 0x0317, 0x0315, 0x0312, 0x030f, 0x030d, 0x030a,
- 0x0307, 0x0305, 0x0302, 0x02ff, 0x02fc, 0x02fa, 0x02f7, 0x02f4,
- 0x02f1, 0x02ef, 0x02ec, 0x02e9, 0x02e6, 0x02e3, 0x02e1, 0x02de,
- 0x02db, 0x02d8, 0x02d5, 0x02d2, 0x02cf, 0x02cd, 0x02ca, 0x02c7,
- 0x02c4, 0x02c1, 0x02be, 0x02bb, 0x02b8, 0x02b5, 0x02b2, 0x02af,
- 0x02ac, 0x02aa, 0x02a7, 0x02a4, 0x02a1, 0x029e, 0x029b, 0x0298,
- 0x0295, 0x0292, 0x028f, 0x028c, 0x0289, 0x0286, 0x0282, 0x027f,
- 0x027c, 0x0279, 0x0276, 0x0273, 0x0270, 0x026d, 0x026a, 0x0267,
- 0x0264, 0x0261, 0x025e, 0x025b, 0x0258, 0x0254, 0x0251, 0x024e,
- 0x024b, 0x0248, 0x0245, 0x0242, 0x023f, 0x023c, 0x0238, 0x0235,
- 0x0232, 0x022f, 0x022c, 0x0229, 0x0226, 0x0223, 0x021f, 0x021c,
- 0x0219, 0x0216, 0x0213, 0x0210, 0x020d, 0x0209, 0x0206, 0x0203,
- 0x0200, 0x01fd, 0x01fa, 0x01f7, 0x01f3, 0x01f0, 0x01ed, 0x01ea,
- 0x01e7, 0x01e4, 0x01e1, 0x01dd, 0x01da, 0x01d7, 0x01d4, 0x01d1,
- 0x01ce, 0x01cb, 0x01c8, 0x01c4, 0x01c1, 0x01be, 0x01bb, 0x01b8,
- 0x01b5, 0x01b2, 0x01af, 0x01ac, 0x01a8, 0x01a5, 0x01a2, 0x019f,
- 0x019c, 0x0199, 0x0196, 0x0193, 0x0190, 0x018d, 0x018a, 0x0187,
- 0x0184, 0x0181, 0x017e, 0x017a, 0x0177, 0x0174, 0x0171, 0x016e,
- 0x016b, 0x0168, 0x0165, 0x0162, 0x015f, 0x015c, 0x0159, 0x0156,
- 0x0154, 0x0151, 0x014e, 0x014b, 0x0148, 0x0145, 0x0142, 0x013f,
- 0x013c, 0x0139, 0x0136, 0x0133, 0x0131, 0x012e, 0x012b, 0x0128,
- 0x0125, 0x0122, 0x011f, 0x011d, 0x011a, 0x0117, 0x0114, 0x0111,
- 0x010f, 0x010c, 0x0109, 0x0106, 0x0104, 0x0101, 0x00fe, 0x00fb,
- 0x00f9, 0x00f6, 0x00f3, 0x00f1, 0x00ee, 0x00eb, 0x00e9, 0x00e6,
- 0x00e4, 0x00e1, 0x00de, 0x00dc, 0x00d9, 0x00d7, 0x00d4, 0x00d2,
- 0x00cf, 0x00cc, 0x00ca, 0x00c7, 0x00c5, 0x00c3, 0x00c0, 0x00be,
- 0x00bb, 0x00b9, 0x00b6, 0x00b4, 0x00b2, 0x00af, 0x00ad, 0x00aa,
- 0x00a8, 0x00a6, 0x00a4, 0x00a1, 0x009f, 0x009d, 0x009a, 0x0098,
- 0x0096, 0x0094, 0x0092, 0x008f, 0x008d, 0x008b, 0x0089, 0x0087,
- 0x0085, 0x0083, 0x0080, 0x007e, 0x007c, 0x007a, 0x0078, 0x0076,
- 0x0074, 0x0072, 0x0070, 0x006e, 0x006c, 0x006a, 0x0069, 0x0067,
- 0x0065, 0x0063, 0x0061, 0x005f, 0x005d, 0x005c, 0x005a, 0x0058,
- 0x0056, 0x0055, 0x0053, 0x0051, 0x004f, 0x004e, 0x004c, 0x004a,
- 0x0049, 0x0047, 0x0046, 0x0044, 0x0043, 0x0041, 0x003f, 0x003e,
- 0x003c, 0x003b, 0x003a, 0x0038, 0x0037, 0x0035, 0x0034, 0x0033,
- 0x0031, 0x0030, 0x002f, 0x002d, 0x002c, 0x002b, 0x0029, 0x0028,
- 0x0027, 0x0026, 0x0025, 0x0023, 0x0022, 0x0021, 0x0020, 0x001f,
- 0x001e, 0x001d, 0x001c, 0x001b, 0x001a, 0x0019, 0x0018, 0x0017,
- 0x0016, 0x0015, 0x0014, 0x0013, 0x0013, 0x0012, 0x0011, 0x0010,
- 0x000f, 0x000f, 0x000e, 0x000d, 0x000c, 0x000c, 0x000b, 0x000a,
- 0x000a, 0x0009, 0x0009, 0x0008, 0x0008, 0x0007, 0x0007, 0x0006,
- 0x0006, 0x0005, 0x0005, 0x0004, 0x0004, 0x0003, 0x0003, 0x0003,
- 0x0002, 0x0002, 0x0002, 0x0002, 0x0001, 0x0001, 0x0001, 0x0001,
- 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-};
-
-static const struct { uint8_t r; uint8_t g; uint8_t b; } rainbow[] = {
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x02, 0x00, 0x00 }, { 0x05, 0x00, 0x00 }, { 0x07, 0x00, 0x00 },
- { 0x0a, 0x00, 0x00 }, { 0x0c, 0x00, 0x00 }, { 0x0f, 0x00, 0x00 }, { 0x11, 0x00, 0x00 },
- { 0x14, 0x00, 0x00 }, { 0x16, 0x00, 0x00 }, { 0x19, 0x00, 0x00 }, { 0x1c, 0x00, 0x00 },
- { 0x1e, 0x00, 0x00 }, { 0x21, 0x00, 0x00 }, { 0x23, 0x00, 0x00 }, { 0x26, 0x00, 0x00 },
- { 0x28, 0x00, 0x00 }, { 0x2b, 0x00, 0x00 }, { 0x2d, 0x00, 0x00 }, { 0x30, 0x00, 0x00 },
- { 0x33, 0x00, 0x00 }, { 0x35, 0x00, 0x00 }, { 0x38, 0x00, 0x00 }, { 0x3a, 0x00, 0x00 },
- { 0x3d, 0x00, 0x00 }, { 0x3f, 0x00, 0x00 }, { 0x42, 0x00, 0x00 }, { 0x44, 0x00, 0x00 },
- { 0x47, 0x00, 0x00 }, { 0x49, 0x00, 0x00 }, { 0x4c, 0x00, 0x00 }, { 0x4f, 0x00, 0x00 },
- { 0x51, 0x00, 0x00 }, { 0x54, 0x00, 0x00 }, { 0x56, 0x00, 0x00 }, { 0x59, 0x00, 0x00 },
- { 0x5b, 0x00, 0x00 }, { 0x5e, 0x00, 0x00 }, { 0x60, 0x00, 0x00 }, { 0x63, 0x00, 0x00 },
- { 0x66, 0x00, 0x00 }, { 0x68, 0x00, 0x00 }, { 0x6b, 0x00, 0x00 }, { 0x6d, 0x00, 0x00 },
- { 0x70, 0x00, 0x00 }, { 0x72, 0x00, 0x00 }, { 0x75, 0x00, 0x00 }, { 0x77, 0x00, 0x00 },
- { 0x7a, 0x00, 0x00 }, { 0x7c, 0x00, 0x00 }, { 0x7f, 0x00, 0x00 }, { 0x82, 0x00, 0x00 },
- { 0x84, 0x00, 0x00 }, { 0x87, 0x00, 0x00 }, { 0x89, 0x00, 0x00 }, { 0x8c, 0x00, 0x00 },
- { 0x8e, 0x00, 0x00 }, { 0x91, 0x00, 0x00 }, { 0x93, 0x00, 0x00 }, { 0x96, 0x00, 0x00 },
- { 0x99, 0x00, 0x00 }, { 0x9b, 0x00, 0x00 }, { 0x9e, 0x00, 0x00 }, { 0xa0, 0x00, 0x00 },
- { 0xa3, 0x00, 0x00 }, { 0xa5, 0x00, 0x00 }, { 0xa8, 0x00, 0x00 }, { 0xaa, 0x00, 0x00 },
- { 0xad, 0x00, 0x00 }, { 0xaf, 0x00, 0x00 }, { 0xb2, 0x00, 0x00 }, { 0xb5, 0x00, 0x00 },
- { 0xb7, 0x00, 0x00 }, { 0xba, 0x00, 0x00 }, { 0xbc, 0x00, 0x00 }, { 0xbf, 0x00, 0x00 },
- { 0xc1, 0x00, 0x00 }, { 0xc4, 0x00, 0x00 }, { 0xc6, 0x00, 0x00 }, { 0xc9, 0x00, 0x00 },
- { 0xcc, 0x00, 0x00 }, { 0xce, 0x00, 0x00 }, { 0xd1, 0x00, 0x00 }, { 0xd3, 0x00, 0x00 },
- { 0xd6, 0x00, 0x00 }, { 0xd8, 0x00, 0x00 }, { 0xdb, 0x00, 0x00 }, { 0xdd, 0x00, 0x00 },
- { 0xe0, 0x00, 0x00 }, { 0xe2, 0x00, 0x00 }, { 0xe5, 0x00, 0x00 }, { 0xe8, 0x00, 0x00 },
- { 0xea, 0x00, 0x00 }, { 0xed, 0x00, 0x00 }, { 0xef, 0x00, 0x00 }, { 0xf2, 0x00, 0x00 },
- { 0xf4, 0x00, 0x00 }, { 0xf7, 0x00, 0x00 }, { 0xf9, 0x00, 0x00 }, { 0xfc, 0x00, 0x00 },
- { 0xff, 0x00, 0x00 }, { 0xff, 0x01, 0x00 }, { 0xff, 0x02, 0x00 }, { 0xff, 0x04, 0x00 },
- { 0xff, 0x05, 0x00 }, { 0xff, 0x06, 0x00 }, { 0xff, 0x07, 0x00 }, { 0xff, 0x09, 0x00 },
- { 0xff, 0x0a, 0x00 }, { 0xff, 0x0b, 0x00 }, { 0xff, 0x0c, 0x00 }, { 0xff, 0x0e, 0x00 },
- { 0xff, 0x0f, 0x00 }, { 0xff, 0x10, 0x00 }, { 0xff, 0x11, 0x00 }, { 0xff, 0x13, 0x00 },
- { 0xff, 0x14, 0x00 }, { 0xff, 0x15, 0x00 }, { 0xff, 0x16, 0x00 }, { 0xff, 0x18, 0x00 },
- { 0xff, 0x19, 0x00 }, { 0xff, 0x1a, 0x00 }, { 0xff, 0x1b, 0x00 }, { 0xff, 0x1d, 0x00 },
- { 0xff, 0x1e, 0x00 }, { 0xff, 0x1f, 0x00 }, { 0xff, 0x20, 0x00 }, { 0xff, 0x22, 0x00 },
- { 0xff, 0x23, 0x00 }, { 0xff, 0x24, 0x00 }, { 0xff, 0x25, 0x00 }, { 0xff, 0x27, 0x00 },
- { 0xff, 0x28, 0x00 }, { 0xff, 0x29, 0x00 }, { 0xff, 0x2a, 0x00 }, { 0xff, 0x2c, 0x00 },
- { 0xff, 0x2d, 0x00 }, { 0xff, 0x2e, 0x00 }, { 0xff, 0x2f, 0x00 }, { 0xff, 0x31, 0x00 },
- { 0xff, 0x32, 0x00 }, { 0xff, 0x33, 0x00 }, { 0xff, 0x34, 0x00 }, { 0xff, 0x36, 0x00 },
- { 0xff, 0x37, 0x00 }, { 0xff, 0x38, 0x00 }, { 0xff, 0x39, 0x00 }, { 0xff, 0x3b, 0x00 },
- { 0xff, 0x3c, 0x00 }, { 0xff, 0x3d, 0x00 }, { 0xff, 0x3e, 0x00 }, { 0xff, 0x40, 0x00 },
- { 0xff, 0x41, 0x00 }, { 0xff, 0x42, 0x00 }, { 0xff, 0x43, 0x00 }, { 0xff, 0x44, 0x00 },
- { 0xff, 0x46, 0x00 }, { 0xff, 0x47, 0x00 }, { 0xff, 0x48, 0x00 }, { 0xff, 0x49, 0x00 },
- { 0xff, 0x4b, 0x00 }, { 0xff, 0x4c, 0x00 }, { 0xff, 0x4d, 0x00 }, { 0xff, 0x4e, 0x00 },
- { 0xff, 0x50, 0x00 }, { 0xff, 0x51, 0x00 }, { 0xff, 0x52, 0x00 }, { 0xff, 0x53, 0x00 },
- { 0xff, 0x55, 0x00 }, { 0xff, 0x56, 0x00 }, { 0xff, 0x57, 0x00 }, { 0xff, 0x58, 0x00 },
- { 0xff, 0x5a, 0x00 }, { 0xff, 0x5b, 0x00 }, { 0xff, 0x5c, 0x00 }, { 0xff, 0x5d, 0x00 },
- { 0xff, 0x5f, 0x00 }, { 0xff, 0x60, 0x00 }, { 0xff, 0x61, 0x00 }, { 0xff, 0x62, 0x00 },
- { 0xff, 0x64, 0x00 }, { 0xff, 0x65, 0x00 }, { 0xff, 0x66, 0x00 }, { 0xff, 0x67, 0x00 },
- { 0xff, 0x69, 0x00 }, { 0xff, 0x6a, 0x00 }, { 0xff, 0x6b, 0x00 }, { 0xff, 0x6c, 0x00 },
- { 0xff, 0x6e, 0x00 }, { 0xff, 0x6f, 0x00 }, { 0xff, 0x70, 0x00 }, { 0xff, 0x71, 0x00 },
- { 0xff, 0x73, 0x00 }, { 0xff, 0x74, 0x00 }, { 0xff, 0x75, 0x00 }, { 0xff, 0x76, 0x00 },
- { 0xff, 0x78, 0x00 }, { 0xff, 0x79, 0x00 }, { 0xff, 0x7a, 0x00 }, { 0xff, 0x7b, 0x00 },
- { 0xff, 0x7d, 0x00 }, { 0xff, 0x7e, 0x00 }, { 0xff, 0x7f, 0x00 }, { 0xff, 0x80, 0x00 },
- { 0xff, 0x81, 0x00 }, { 0xff, 0x83, 0x00 }, { 0xff, 0x84, 0x00 }, { 0xff, 0x85, 0x00 },
- { 0xff, 0x86, 0x00 }, { 0xff, 0x88, 0x00 }, { 0xff, 0x89, 0x00 }, { 0xff, 0x8a, 0x00 },
- { 0xff, 0x8b, 0x00 }, { 0xff, 0x8d, 0x00 }, { 0xff, 0x8e, 0x00 }, { 0xff, 0x8f, 0x00 },
- { 0xff, 0x90, 0x00 }, { 0xff, 0x92, 0x00 }, { 0xff, 0x93, 0x00 }, { 0xff, 0x94, 0x00 },
- { 0xff, 0x95, 0x00 }, { 0xff, 0x97, 0x00 }, { 0xff, 0x98, 0x00 }, { 0xff, 0x99, 0x00 },
- { 0xff, 0x9a, 0x00 }, { 0xff, 0x9c, 0x00 }, { 0xff, 0x9d, 0x00 }, { 0xff, 0x9e, 0x00 },
- { 0xff, 0x9f, 0x00 }, { 0xff, 0xa1, 0x00 }, { 0xff, 0xa2, 0x00 }, { 0xff, 0xa3, 0x00 },
- { 0xff, 0xa4, 0x00 }, { 0xff, 0xa6, 0x00 }, { 0xff, 0xa7, 0x00 }, { 0xff, 0xa8, 0x00 },
- { 0xff, 0xa9, 0x00 }, { 0xff, 0xab, 0x00 }, { 0xff, 0xac, 0x00 }, { 0xff, 0xad, 0x00 },
- { 0xff, 0xae, 0x00 }, { 0xff, 0xb0, 0x00 }, { 0xff, 0xb1, 0x00 }, { 0xff, 0xb2, 0x00 },
- { 0xff, 0xb3, 0x00 }, { 0xff, 0xb5, 0x00 }, { 0xff, 0xb6, 0x00 }, { 0xff, 0xb7, 0x00 },
- { 0xff, 0xb8, 0x00 }, { 0xff, 0xba, 0x00 }, { 0xff, 0xbb, 0x00 }, { 0xff, 0xbc, 0x00 },
- { 0xff, 0xbd, 0x00 }, { 0xff, 0xbf, 0x00 }, { 0xff, 0xc0, 0x00 }, { 0xff, 0xc1, 0x00 },
- { 0xff, 0xc2, 0x00 }, { 0xff, 0xc3, 0x00 }, { 0xff, 0xc5, 0x00 }, { 0xff, 0xc6, 0x00 },
- { 0xff, 0xc7, 0x00 }, { 0xff, 0xc8, 0x00 }, { 0xff, 0xca, 0x00 }, { 0xff, 0xcb, 0x00 },
- { 0xff, 0xcc, 0x00 }, { 0xff, 0xcd, 0x00 }, { 0xff, 0xcf, 0x00 }, { 0xff, 0xd0, 0x00 },
- { 0xff, 0xd1, 0x00 }, { 0xff, 0xd2, 0x00 }, { 0xff, 0xd4, 0x00 }, { 0xff, 0xd5, 0x00 },
- { 0xff, 0xd6, 0x00 }, { 0xff, 0xd7, 0x00 }, { 0xff, 0xd9, 0x00 }, { 0xff, 0xda, 0x00 },
- { 0xff, 0xdb, 0x00 }, { 0xff, 0xdc, 0x00 }, { 0xff, 0xde, 0x00 }, { 0xff, 0xdf, 0x00 },
- { 0xff, 0xe0, 0x00 }, { 0xff, 0xe1, 0x00 }, { 0xff, 0xe3, 0x00 }, { 0xff, 0xe4, 0x00 },
- { 0xff, 0xe5, 0x00 }, { 0xff, 0xe6, 0x00 }, { 0xff, 0xe8, 0x00 }, { 0xff, 0xe9, 0x00 },
- { 0xff, 0xea, 0x00 }, { 0xff, 0xeb, 0x00 }, { 0xff, 0xed, 0x00 }, { 0xff, 0xee, 0x00 },
- { 0xff, 0xef, 0x00 }, { 0xff, 0xf0, 0x00 }, { 0xff, 0xf2, 0x00 }, { 0xff, 0xf3, 0x00 },
- { 0xff, 0xf4, 0x00 }, { 0xff, 0xf5, 0x00 }, { 0xff, 0xf7, 0x00 }, { 0xff, 0xf8, 0x00 },
- { 0xff, 0xf9, 0x00 }, { 0xff, 0xfa, 0x00 }, { 0xff, 0xfc, 0x00 }, { 0xff, 0xfd, 0x00 },
- { 0xff, 0xfe, 0x00 }, { 0xff, 0xff, 0x00 }, { 0xfe, 0xff, 0x00 }, { 0xfc, 0xff, 0x00 },
- { 0xfb, 0xff, 0x00 }, { 0xfa, 0xff, 0x00 }, { 0xf9, 0xff, 0x00 }, { 0xf7, 0xff, 0x00 },
- { 0xf6, 0xff, 0x00 }, { 0xf5, 0xff, 0x00 }, { 0xf4, 0xff, 0x00 }, { 0xf2, 0xff, 0x00 },
- { 0xf1, 0xff, 0x00 }, { 0xf0, 0xff, 0x00 }, { 0xef, 0xff, 0x00 }, { 0xed, 0xff, 0x00 },
- { 0xec, 0xff, 0x00 }, { 0xeb, 0xff, 0x00 }, { 0xea, 0xff, 0x00 }, { 0xe8, 0xff, 0x00 },
- { 0xe7, 0xff, 0x00 }, { 0xe6, 0xff, 0x00 }, { 0xe5, 0xff, 0x00 }, { 0xe3, 0xff, 0x00 },
- { 0xe2, 0xff, 0x00 }, { 0xe1, 0xff, 0x00 }, { 0xe0, 0xff, 0x00 }, { 0xde, 0xff, 0x00 },
- { 0xdd, 0xff, 0x00 }, { 0xdc, 0xff, 0x00 }, { 0xdb, 0xff, 0x00 }, { 0xd9, 0xff, 0x00 },
- { 0xd8, 0xff, 0x00 }, { 0xd7, 0xff, 0x00 }, { 0xd6, 0xff, 0x00 }, { 0xd4, 0xff, 0x00 },
- { 0xd3, 0xff, 0x00 }, { 0xd2, 0xff, 0x00 }, { 0xd1, 0xff, 0x00 }, { 0xcf, 0xff, 0x00 },
- { 0xce, 0xff, 0x00 }, { 0xcd, 0xff, 0x00 }, { 0xcc, 0xff, 0x00 }, { 0xca, 0xff, 0x00 },
- { 0xc9, 0xff, 0x00 }, { 0xc8, 0xff, 0x00 }, { 0xc7, 0xff, 0x00 }, { 0xc5, 0xff, 0x00 },
- { 0xc4, 0xff, 0x00 }, { 0xc3, 0xff, 0x00 }, { 0xc2, 0xff, 0x00 }, { 0xc0, 0xff, 0x00 },
- { 0xbf, 0xff, 0x00 }, { 0xbe, 0xff, 0x00 }, { 0xbd, 0xff, 0x00 }, { 0xbc, 0xff, 0x00 },
- { 0xba, 0xff, 0x00 }, { 0xb9, 0xff, 0x00 }, { 0xb8, 0xff, 0x00 }, { 0xb7, 0xff, 0x00 },
- { 0xb5, 0xff, 0x00 }, { 0xb4, 0xff, 0x00 }, { 0xb3, 0xff, 0x00 }, { 0xb2, 0xff, 0x00 },
- { 0xb0, 0xff, 0x00 }, { 0xaf, 0xff, 0x00 }, { 0xae, 0xff, 0x00 }, { 0xad, 0xff, 0x00 },
- { 0xab, 0xff, 0x00 }, { 0xaa, 0xff, 0x00 }, { 0xa9, 0xff, 0x00 }, { 0xa8, 0xff, 0x00 },
- { 0xa6, 0xff, 0x00 }, { 0xa5, 0xff, 0x00 }, { 0xa4, 0xff, 0x00 }, { 0xa3, 0xff, 0x00 },
- { 0xa1, 0xff, 0x00 }, { 0xa0, 0xff, 0x00 }, { 0x9f, 0xff, 0x00 }, { 0x9e, 0xff, 0x00 },
- { 0x9c, 0xff, 0x00 }, { 0x9b, 0xff, 0x00 }, { 0x9a, 0xff, 0x00 }, { 0x99, 0xff, 0x00 },
- { 0x97, 0xff, 0x00 }, { 0x96, 0xff, 0x00 }, { 0x95, 0xff, 0x00 }, { 0x94, 0xff, 0x00 },
- { 0x92, 0xff, 0x00 }, { 0x91, 0xff, 0x00 }, { 0x90, 0xff, 0x00 }, { 0x8f, 0xff, 0x00 },
- { 0x8d, 0xff, 0x00 }, { 0x8c, 0xff, 0x00 }, { 0x8b, 0xff, 0x00 }, { 0x8a, 0xff, 0x00 },
- { 0x88, 0xff, 0x00 }, { 0x87, 0xff, 0x00 }, { 0x86, 0xff, 0x00 }, { 0x85, 0xff, 0x00 },
- { 0x83, 0xff, 0x00 }, { 0x82, 0xff, 0x00 }, { 0x81, 0xff, 0x00 }, { 0x80, 0xff, 0x00 },
- { 0x7f, 0xff, 0x00 }, { 0x7d, 0xff, 0x00 }, { 0x7c, 0xff, 0x00 }, { 0x7b, 0xff, 0x00 },
- { 0x7a, 0xff, 0x00 }, { 0x78, 0xff, 0x00 }, { 0x77, 0xff, 0x00 }, { 0x76, 0xff, 0x00 },
- { 0x75, 0xff, 0x00 }, { 0x73, 0xff, 0x00 }, { 0x72, 0xff, 0x00 }, { 0x71, 0xff, 0x00 },
- { 0x70, 0xff, 0x00 }, { 0x6e, 0xff, 0x00 }, { 0x6d, 0xff, 0x00 }, { 0x6c, 0xff, 0x00 },
- { 0x6b, 0xff, 0x00 }, { 0x69, 0xff, 0x00 }, { 0x68, 0xff, 0x00 }, { 0x67, 0xff, 0x00 },
- { 0x66, 0xff, 0x00 }, { 0x64, 0xff, 0x00 }, { 0x63, 0xff, 0x00 }, { 0x62, 0xff, 0x00 },
- { 0x61, 0xff, 0x00 }, { 0x5f, 0xff, 0x00 }, { 0x5e, 0xff, 0x00 }, { 0x5d, 0xff, 0x00 },
- { 0x5c, 0xff, 0x00 }, { 0x5a, 0xff, 0x00 }, { 0x59, 0xff, 0x00 }, { 0x58, 0xff, 0x00 },
- { 0x57, 0xff, 0x00 }, { 0x55, 0xff, 0x00 }, { 0x54, 0xff, 0x00 }, { 0x53, 0xff, 0x00 },
- { 0x52, 0xff, 0x00 }, { 0x50, 0xff, 0x00 }, { 0x4f, 0xff, 0x00 }, { 0x4e, 0xff, 0x00 },
- { 0x4d, 0xff, 0x00 }, { 0x4b, 0xff, 0x00 }, { 0x4a, 0xff, 0x00 }, { 0x49, 0xff, 0x00 },
- { 0x48, 0xff, 0x00 }, { 0x46, 0xff, 0x00 }, { 0x45, 0xff, 0x00 }, { 0x44, 0xff, 0x00 },
- { 0x43, 0xff, 0x00 }, { 0x41, 0xff, 0x00 }, { 0x40, 0xff, 0x00 }, { 0x3f, 0xff, 0x00 },
- { 0x3e, 0xff, 0x00 }, { 0x3d, 0xff, 0x00 }, { 0x3b, 0xff, 0x00 }, { 0x3a, 0xff, 0x00 },
- { 0x39, 0xff, 0x00 }, { 0x38, 0xff, 0x00 }, { 0x36, 0xff, 0x00 }, { 0x35, 0xff, 0x00 },
- { 0x34, 0xff, 0x00 }, { 0x33, 0xff, 0x00 }, { 0x31, 0xff, 0x00 }, { 0x30, 0xff, 0x00 },
- { 0x2f, 0xff, 0x00 }, { 0x2e, 0xff, 0x00 }, { 0x2c, 0xff, 0x00 }, { 0x2b, 0xff, 0x00 },
- { 0x2a, 0xff, 0x00 }, { 0x29, 0xff, 0x00 }, { 0x27, 0xff, 0x00 }, { 0x26, 0xff, 0x00 },
- { 0x25, 0xff, 0x00 }, { 0x24, 0xff, 0x00 }, { 0x22, 0xff, 0x00 }, { 0x21, 0xff, 0x00 },
- { 0x20, 0xff, 0x00 }, { 0x1f, 0xff, 0x00 }, { 0x1d, 0xff, 0x00 }, { 0x1c, 0xff, 0x00 },
- { 0x1b, 0xff, 0x00 }, { 0x1a, 0xff, 0x00 }, { 0x18, 0xff, 0x00 }, { 0x17, 0xff, 0x00 },
- { 0x16, 0xff, 0x00 }, { 0x15, 0xff, 0x00 }, { 0x13, 0xff, 0x00 }, { 0x12, 0xff, 0x00 },
- { 0x11, 0xff, 0x00 }, { 0x10, 0xff, 0x00 }, { 0x0e, 0xff, 0x00 }, { 0x0d, 0xff, 0x00 },
- { 0x0c, 0xff, 0x00 }, { 0x0b, 0xff, 0x00 }, { 0x09, 0xff, 0x00 }, { 0x08, 0xff, 0x00 },
- { 0x07, 0xff, 0x00 }, { 0x06, 0xff, 0x00 }, { 0x04, 0xff, 0x00 }, { 0x03, 0xff, 0x00 },
- { 0x02, 0xff, 0x00 }, { 0x01, 0xff, 0x00 }, { 0x00, 0xff, 0x00 }, { 0x00, 0xff, 0x02 },
- { 0x00, 0xff, 0x03 }, { 0x00, 0xff, 0x04 }, { 0x00, 0xff, 0x05 }, { 0x00, 0xff, 0x07 },
- { 0x00, 0xff, 0x08 }, { 0x00, 0xff, 0x09 }, { 0x00, 0xff, 0x0a }, { 0x00, 0xff, 0x0c },
- { 0x00, 0xff, 0x0d }, { 0x00, 0xff, 0x0e }, { 0x00, 0xff, 0x0f }, { 0x00, 0xff, 0x11 },
- { 0x00, 0xff, 0x12 }, { 0x00, 0xff, 0x13 }, { 0x00, 0xff, 0x14 }, { 0x00, 0xff, 0x16 },
- { 0x00, 0xff, 0x17 }, { 0x00, 0xff, 0x18 }, { 0x00, 0xff, 0x19 }, { 0x00, 0xff, 0x1b },
- { 0x00, 0xff, 0x1c }, { 0x00, 0xff, 0x1d }, { 0x00, 0xff, 0x1e }, { 0x00, 0xff, 0x20 },
- { 0x00, 0xff, 0x21 }, { 0x00, 0xff, 0x22 }, { 0x00, 0xff, 0x23 }, { 0x00, 0xff, 0x25 },
- { 0x00, 0xff, 0x26 }, { 0x00, 0xff, 0x27 }, { 0x00, 0xff, 0x28 }, { 0x00, 0xff, 0x2a },
- { 0x00, 0xff, 0x2b }, { 0x00, 0xff, 0x2c }, { 0x00, 0xff, 0x2d }, { 0x00, 0xff, 0x2f },
- { 0x00, 0xff, 0x30 }, { 0x00, 0xff, 0x31 }, { 0x00, 0xff, 0x32 }, { 0x00, 0xff, 0x34 },
- { 0x00, 0xff, 0x35 }, { 0x00, 0xff, 0x36 }, { 0x00, 0xff, 0x37 }, { 0x00, 0xff, 0x39 },
- { 0x00, 0xff, 0x3a }, { 0x00, 0xff, 0x3b }, { 0x00, 0xff, 0x3c }, { 0x00, 0xff, 0x3e },
- { 0x00, 0xff, 0x3f }, { 0x00, 0xff, 0x40 }, { 0x00, 0xff, 0x41 }, { 0x00, 0xff, 0x42 },
- { 0x00, 0xff, 0x44 }, { 0x00, 0xff, 0x45 }, { 0x00, 0xff, 0x46 }, { 0x00, 0xff, 0x47 },
- { 0x00, 0xff, 0x49 }, { 0x00, 0xff, 0x4a }, { 0x00, 0xff, 0x4b }, { 0x00, 0xff, 0x4c },
- { 0x00, 0xff, 0x4e }, { 0x00, 0xff, 0x4f }, { 0x00, 0xff, 0x50 }, { 0x00, 0xff, 0x51 },
- { 0x00, 0xff, 0x53 }, { 0x00, 0xff, 0x54 }, { 0x00, 0xff, 0x55 }, { 0x00, 0xff, 0x56 },
- { 0x00, 0xff, 0x58 }, { 0x00, 0xff, 0x59 }, { 0x00, 0xff, 0x5a }, { 0x00, 0xff, 0x5b },
- { 0x00, 0xff, 0x5d }, { 0x00, 0xff, 0x5e }, { 0x00, 0xff, 0x5f }, { 0x00, 0xff, 0x60 },
- { 0x00, 0xff, 0x62 }, { 0x00, 0xff, 0x63 }, { 0x00, 0xff, 0x64 }, { 0x00, 0xff, 0x65 },
- { 0x00, 0xff, 0x67 }, { 0x00, 0xff, 0x68 }, { 0x00, 0xff, 0x69 }, { 0x00, 0xff, 0x6a },
- { 0x00, 0xff, 0x6c }, { 0x00, 0xff, 0x6d }, { 0x00, 0xff, 0x6e }, { 0x00, 0xff, 0x6f },
- { 0x00, 0xff, 0x71 }, { 0x00, 0xff, 0x72 }, { 0x00, 0xff, 0x73 }, { 0x00, 0xff, 0x74 },
- { 0x00, 0xff, 0x76 }, { 0x00, 0xff, 0x77 }, { 0x00, 0xff, 0x78 }, { 0x00, 0xff, 0x79 },
- { 0x00, 0xff, 0x7b }, { 0x00, 0xff, 0x7c }, { 0x00, 0xff, 0x7d }, { 0x00, 0xff, 0x7e },
- { 0x00, 0xff, 0x80 }, { 0x00, 0xff, 0x81 }, { 0x00, 0xff, 0x82 }, { 0x00, 0xff, 0x83 },
- { 0x00, 0xff, 0x84 }, { 0x00, 0xff, 0x86 }, { 0x00, 0xff, 0x87 }, { 0x00, 0xff, 0x88 },
- { 0x00, 0xff, 0x89 }, { 0x00, 0xff, 0x8b }, { 0x00, 0xff, 0x8c }, { 0x00, 0xff, 0x8d },
- { 0x00, 0xff, 0x8e }, { 0x00, 0xff, 0x90 }, { 0x00, 0xff, 0x91 }, { 0x00, 0xff, 0x92 },
- { 0x00, 0xff, 0x93 }, { 0x00, 0xff, 0x95 }, { 0x00, 0xff, 0x96 }, { 0x00, 0xff, 0x97 },
- { 0x00, 0xff, 0x98 }, { 0x00, 0xff, 0x9a }, { 0x00, 0xff, 0x9b }, { 0x00, 0xff, 0x9c },
- { 0x00, 0xff, 0x9d }, { 0x00, 0xff, 0x9f }, { 0x00, 0xff, 0xa0 }, { 0x00, 0xff, 0xa1 },
- { 0x00, 0xff, 0xa2 }, { 0x00, 0xff, 0xa4 }, { 0x00, 0xff, 0xa5 }, { 0x00, 0xff, 0xa6 },
- { 0x00, 0xff, 0xa7 }, { 0x00, 0xff, 0xa9 }, { 0x00, 0xff, 0xaa }, { 0x00, 0xff, 0xab },
- { 0x00, 0xff, 0xac }, { 0x00, 0xff, 0xae }, { 0x00, 0xff, 0xaf }, { 0x00, 0xff, 0xb0 },
- { 0x00, 0xff, 0xb1 }, { 0x00, 0xff, 0xb3 }, { 0x00, 0xff, 0xb4 }, { 0x00, 0xff, 0xb5 },
- { 0x00, 0xff, 0xb6 }, { 0x00, 0xff, 0xb8 }, { 0x00, 0xff, 0xb9 }, { 0x00, 0xff, 0xba },
- { 0x00, 0xff, 0xbb }, { 0x00, 0xff, 0xbd }, { 0x00, 0xff, 0xbe }, { 0x00, 0xff, 0xbf },
- { 0x00, 0xff, 0xc0 }, { 0x00, 0xff, 0xc1 }, { 0x00, 0xff, 0xc3 }, { 0x00, 0xff, 0xc4 },
- { 0x00, 0xff, 0xc5 }, { 0x00, 0xff, 0xc6 }, { 0x00, 0xff, 0xc8 }, { 0x00, 0xff, 0xc9 },
- { 0x00, 0xff, 0xca }, { 0x00, 0xff, 0xcb }, { 0x00, 0xff, 0xcd }, { 0x00, 0xff, 0xce },
- { 0x00, 0xff, 0xcf }, { 0x00, 0xff, 0xd0 }, { 0x00, 0xff, 0xd2 }, { 0x00, 0xff, 0xd3 },
- { 0x00, 0xff, 0xd4 }, { 0x00, 0xff, 0xd5 }, { 0x00, 0xff, 0xd7 }, { 0x00, 0xff, 0xd8 },
- { 0x00, 0xff, 0xd9 }, { 0x00, 0xff, 0xda }, { 0x00, 0xff, 0xdc }, { 0x00, 0xff, 0xdd },
- { 0x00, 0xff, 0xde }, { 0x00, 0xff, 0xdf }, { 0x00, 0xff, 0xe1 }, { 0x00, 0xff, 0xe2 },
- { 0x00, 0xff, 0xe3 }, { 0x00, 0xff, 0xe4 }, { 0x00, 0xff, 0xe6 }, { 0x00, 0xff, 0xe7 },
- { 0x00, 0xff, 0xe8 }, { 0x00, 0xff, 0xe9 }, { 0x00, 0xff, 0xeb }, { 0x00, 0xff, 0xec },
- { 0x00, 0xff, 0xed }, { 0x00, 0xff, 0xee }, { 0x00, 0xff, 0xf0 }, { 0x00, 0xff, 0xf1 },
- { 0x00, 0xff, 0xf2 }, { 0x00, 0xff, 0xf3 }, { 0x00, 0xff, 0xf5 }, { 0x00, 0xff, 0xf6 },
- { 0x00, 0xff, 0xf7 }, { 0x00, 0xff, 0xf8 }, { 0x00, 0xff, 0xfa }, { 0x00, 0xff, 0xfb },
- { 0x00, 0xff, 0xfc }, { 0x00, 0xff, 0xfd }, { 0x00, 0xff, 0xff }, { 0x00, 0xfe, 0xff },
- { 0x00, 0xfd, 0xff }, { 0x00, 0xfc, 0xff }, { 0x00, 0xfb, 0xff }, { 0x00, 0xf9, 0xff },
- { 0x00, 0xf8, 0xff }, { 0x00, 0xf7, 0xff }, { 0x00, 0xf6, 0xff }, { 0x00, 0xf4, 0xff },
- { 0x00, 0xf3, 0xff }, { 0x00, 0xf2, 0xff }, { 0x00, 0xf1, 0xff }, { 0x00, 0xef, 0xff },
- { 0x00, 0xee, 0xff }, { 0x00, 0xed, 0xff }, { 0x00, 0xec, 0xff }, { 0x00, 0xea, 0xff },
- { 0x00, 0xe9, 0xff }, { 0x00, 0xe8, 0xff }, { 0x00, 0xe7, 0xff }, { 0x00, 0xe5, 0xff },
- { 0x00, 0xe4, 0xff }, { 0x00, 0xe3, 0xff }, { 0x00, 0xe2, 0xff }, { 0x00, 0xe0, 0xff },
- { 0x00, 0xdf, 0xff }, { 0x00, 0xde, 0xff }, { 0x00, 0xdd, 0xff }, { 0x00, 0xdb, 0xff },
- { 0x00, 0xda, 0xff }, { 0x00, 0xd9, 0xff }, { 0x00, 0xd8, 0xff }, { 0x00, 0xd6, 0xff },
- { 0x00, 0xd5, 0xff }, { 0x00, 0xd4, 0xff }, { 0x00, 0xd3, 0xff }, { 0x00, 0xd1, 0xff },
- { 0x00, 0xd0, 0xff }, { 0x00, 0xcf, 0xff }, { 0x00, 0xce, 0xff }, { 0x00, 0xcc, 0xff },
- { 0x00, 0xcb, 0xff }, { 0x00, 0xca, 0xff }, { 0x00, 0xc9, 0xff }, { 0x00, 0xc7, 0xff },
- { 0x00, 0xc6, 0xff }, { 0x00, 0xc5, 0xff }, { 0x00, 0xc4, 0xff }, { 0x00, 0xc2, 0xff },
- { 0x00, 0xc1, 0xff }, { 0x00, 0xc0, 0xff }, { 0x00, 0xbf, 0xff }, { 0x00, 0xbe, 0xff },
- { 0x00, 0xbc, 0xff }, { 0x00, 0xbb, 0xff }, { 0x00, 0xba, 0xff }, { 0x00, 0xb9, 0xff },
- { 0x00, 0xb7, 0xff }, { 0x00, 0xb6, 0xff }, { 0x00, 0xb5, 0xff }, { 0x00, 0xb4, 0xff },
- { 0x00, 0xb2, 0xff }, { 0x00, 0xb1, 0xff }, { 0x00, 0xb0, 0xff }, { 0x00, 0xaf, 0xff },
- { 0x00, 0xad, 0xff }, { 0x00, 0xac, 0xff }, { 0x00, 0xab, 0xff }, { 0x00, 0xaa, 0xff },
- { 0x00, 0xa8, 0xff }, { 0x00, 0xa7, 0xff }, { 0x00, 0xa6, 0xff }, { 0x00, 0xa5, 0xff },
- { 0x00, 0xa3, 0xff }, { 0x00, 0xa2, 0xff }, { 0x00, 0xa1, 0xff }, { 0x00, 0xa0, 0xff },
- { 0x00, 0x9e, 0xff }, { 0x00, 0x9d, 0xff }, { 0x00, 0x9c, 0xff }, { 0x00, 0x9b, 0xff },
- { 0x00, 0x99, 0xff }, { 0x00, 0x98, 0xff }, { 0x00, 0x97, 0xff }, { 0x00, 0x96, 0xff },
- { 0x00, 0x94, 0xff }, { 0x00, 0x93, 0xff }, { 0x00, 0x92, 0xff }, { 0x00, 0x91, 0xff },
- { 0x00, 0x8f, 0xff }, { 0x00, 0x8e, 0xff }, { 0x00, 0x8d, 0xff }, { 0x00, 0x8c, 0xff },
- { 0x00, 0x8a, 0xff }, { 0x00, 0x89, 0xff }, { 0x00, 0x88, 0xff }, { 0x00, 0x87, 0xff },
- { 0x00, 0x85, 0xff }, { 0x00, 0x84, 0xff }, { 0x00, 0x83, 0xff }, { 0x00, 0x82, 0xff },
- { 0x00, 0x80, 0xff }, { 0x00, 0x7f, 0xff }, { 0x00, 0x7e, 0xff }, { 0x00, 0x7d, 0xff },
- { 0x00, 0x7c, 0xff }, { 0x00, 0x7a, 0xff }, { 0x00, 0x79, 0xff }, { 0x00, 0x78, 0xff },
- { 0x00, 0x77, 0xff }, { 0x00, 0x75, 0xff }, { 0x00, 0x74, 0xff }, { 0x00, 0x73, 0xff },
- { 0x00, 0x72, 0xff }, { 0x00, 0x70, 0xff }, { 0x00, 0x6f, 0xff }, { 0x00, 0x6e, 0xff },
- { 0x00, 0x6d, 0xff }, { 0x00, 0x6b, 0xff }, { 0x00, 0x6a, 0xff }, { 0x00, 0x69, 0xff },
- { 0x00, 0x68, 0xff }, { 0x00, 0x66, 0xff }, { 0x00, 0x65, 0xff }, { 0x00, 0x64, 0xff },
- { 0x00, 0x63, 0xff }, { 0x00, 0x61, 0xff }, { 0x00, 0x60, 0xff }, { 0x00, 0x5f, 0xff },
- { 0x00, 0x5e, 0xff }, { 0x00, 0x5c, 0xff }, { 0x00, 0x5b, 0xff }, { 0x00, 0x5a, 0xff },
- { 0x00, 0x59, 0xff }, { 0x00, 0x57, 0xff }, { 0x00, 0x56, 0xff }, { 0x00, 0x55, 0xff },
- { 0x00, 0x54, 0xff }, { 0x00, 0x52, 0xff }, { 0x00, 0x51, 0xff }, { 0x00, 0x50, 0xff },
- { 0x00, 0x4f, 0xff }, { 0x00, 0x4d, 0xff }, { 0x00, 0x4c, 0xff }, { 0x00, 0x4b, 0xff },
- { 0x00, 0x4a, 0xff }, { 0x00, 0x48, 0xff }, { 0x00, 0x47, 0xff }, { 0x00, 0x46, 0xff },
- { 0x00, 0x45, 0xff }, { 0x00, 0x43, 0xff }, { 0x00, 0x42, 0xff }, { 0x00, 0x41, 0xff },
- { 0x00, 0x40, 0xff }, { 0x00, 0x3f, 0xff }, { 0x00, 0x3d, 0xff }, { 0x00, 0x3c, 0xff },
- { 0x00, 0x3b, 0xff }, { 0x00, 0x3a, 0xff }, { 0x00, 0x38, 0xff }, { 0x00, 0x37, 0xff },
- { 0x00, 0x36, 0xff }, { 0x00, 0x35, 0xff }, { 0x00, 0x33, 0xff }, { 0x00, 0x32, 0xff },
- { 0x00, 0x31, 0xff }, { 0x00, 0x30, 0xff }, { 0x00, 0x2e, 0xff }, { 0x00, 0x2d, 0xff },
- { 0x00, 0x2c, 0xff }, { 0x00, 0x2b, 0xff }, { 0x00, 0x29, 0xff }, { 0x00, 0x28, 0xff },
- { 0x00, 0x27, 0xff }, { 0x00, 0x26, 0xff }, { 0x00, 0x24, 0xff }, { 0x00, 0x23, 0xff },
- { 0x00, 0x22, 0xff }, { 0x00, 0x21, 0xff }, { 0x00, 0x1f, 0xff }, { 0x00, 0x1e, 0xff },
- { 0x00, 0x1d, 0xff }, { 0x00, 0x1c, 0xff }, { 0x00, 0x1a, 0xff }, { 0x00, 0x19, 0xff },
- { 0x00, 0x18, 0xff }, { 0x00, 0x17, 0xff }, { 0x00, 0x15, 0xff }, { 0x00, 0x14, 0xff },
- { 0x00, 0x13, 0xff }, { 0x00, 0x12, 0xff }, { 0x00, 0x10, 0xff }, { 0x00, 0x0f, 0xff },
- { 0x00, 0x0e, 0xff }, { 0x00, 0x0d, 0xff }, { 0x00, 0x0b, 0xff }, { 0x00, 0x0a, 0xff },
- { 0x00, 0x09, 0xff }, { 0x00, 0x08, 0xff }, { 0x00, 0x06, 0xff }, { 0x00, 0x05, 0xff },
- { 0x00, 0x04, 0xff }, { 0x00, 0x03, 0xff }, { 0x00, 0x01, 0xff }, { 0x00, 0x00, 0xff },
- { 0x01, 0x00, 0xff }, { 0x02, 0x00, 0xff }, { 0x03, 0x00, 0xff }, { 0x05, 0x00, 0xff },
- { 0x06, 0x00, 0xff }, { 0x07, 0x00, 0xff }, { 0x08, 0x00, 0xff }, { 0x0a, 0x00, 0xff },
- { 0x0b, 0x00, 0xff }, { 0x0c, 0x00, 0xff }, { 0x0d, 0x00, 0xff }, { 0x0f, 0x00, 0xff },
- { 0x10, 0x00, 0xff }, { 0x11, 0x00, 0xff }, { 0x12, 0x00, 0xff }, { 0x14, 0x00, 0xff },
- { 0x15, 0x00, 0xff }, { 0x16, 0x00, 0xff }, { 0x17, 0x00, 0xff }, { 0x19, 0x00, 0xff },
- { 0x1a, 0x00, 0xff }, { 0x1b, 0x00, 0xff }, { 0x1c, 0x00, 0xff }, { 0x1e, 0x00, 0xff },
- { 0x1f, 0x00, 0xff }, { 0x20, 0x00, 0xff }, { 0x21, 0x00, 0xff }, { 0x23, 0x00, 0xff },
- { 0x24, 0x00, 0xff }, { 0x25, 0x00, 0xff }, { 0x26, 0x00, 0xff }, { 0x28, 0x00, 0xff },
- { 0x29, 0x00, 0xff }, { 0x2a, 0x00, 0xff }, { 0x2b, 0x00, 0xff }, { 0x2d, 0x00, 0xff },
- { 0x2e, 0x00, 0xff }, { 0x2f, 0x00, 0xff }, { 0x30, 0x00, 0xff }, { 0x32, 0x00, 0xff },
- { 0x33, 0x00, 0xff }, { 0x34, 0x00, 0xff }, { 0x35, 0x00, 0xff }, { 0x37, 0x00, 0xff },
- { 0x38, 0x00, 0xff }, { 0x39, 0x00, 0xff }, { 0x3a, 0x00, 0xff }, { 0x3c, 0x00, 0xff },
- { 0x3d, 0x00, 0xff }, { 0x3e, 0x00, 0xff }, { 0x3f, 0x00, 0xff }, { 0x40, 0x00, 0xff },
- { 0x42, 0x00, 0xff }, { 0x43, 0x00, 0xff }, { 0x44, 0x00, 0xff }, { 0x45, 0x00, 0xff },
- { 0x47, 0x00, 0xff }, { 0x48, 0x00, 0xff }, { 0x49, 0x00, 0xff }, { 0x4a, 0x00, 0xff },
- { 0x4c, 0x00, 0xff }, { 0x4d, 0x00, 0xff }, { 0x4e, 0x00, 0xff }, { 0x4f, 0x00, 0xff },
- { 0x51, 0x00, 0xff }, { 0x52, 0x00, 0xff }, { 0x53, 0x00, 0xff }, { 0x54, 0x00, 0xff },
- { 0x56, 0x00, 0xff }, { 0x57, 0x00, 0xff }, { 0x58, 0x00, 0xff }, { 0x59, 0x00, 0xff },
- { 0x5b, 0x00, 0xff }, { 0x5c, 0x00, 0xff }, { 0x5d, 0x00, 0xff }, { 0x5e, 0x00, 0xff },
- { 0x60, 0x00, 0xff }, { 0x61, 0x00, 0xff }, { 0x62, 0x00, 0xff }, { 0x63, 0x00, 0xff },
- { 0x65, 0x00, 0xff }, { 0x66, 0x00, 0xff }, { 0x67, 0x00, 0xff }, { 0x68, 0x00, 0xff },
- { 0x6a, 0x00, 0xff }, { 0x6b, 0x00, 0xff }, { 0x6c, 0x00, 0xff }, { 0x6d, 0x00, 0xff },
- { 0x6f, 0x00, 0xff }, { 0x70, 0x00, 0xff }, { 0x71, 0x00, 0xff }, { 0x72, 0x00, 0xff },
- { 0x74, 0x00, 0xff }, { 0x75, 0x00, 0xff }, { 0x76, 0x00, 0xff }, { 0x77, 0x00, 0xff },
- { 0x79, 0x00, 0xff }, { 0x7a, 0x00, 0xff }, { 0x7b, 0x00, 0xff }, { 0x7c, 0x00, 0xff },
- { 0x7e, 0x00, 0xff }, { 0x7f, 0x00, 0xff }, { 0x80, 0x00, 0xff }, { 0x81, 0x00, 0xff },
- { 0x82, 0x00, 0xff }, { 0x84, 0x00, 0xff }, { 0x85, 0x00, 0xff }, { 0x86, 0x00, 0xff },
- { 0x87, 0x00, 0xff }, { 0x89, 0x00, 0xff }, { 0x8a, 0x00, 0xff }, { 0x8b, 0x00, 0xff },
- { 0x8c, 0x00, 0xff }, { 0x8e, 0x00, 0xff }, { 0x8f, 0x00, 0xff }, { 0x90, 0x00, 0xff },
- { 0x91, 0x00, 0xff }, { 0x93, 0x00, 0xff }, { 0x94, 0x00, 0xff }, { 0x95, 0x00, 0xff },
- { 0x96, 0x00, 0xff }, { 0x98, 0x00, 0xff }, { 0x99, 0x00, 0xff }, { 0x9a, 0x00, 0xff },
- { 0x9b, 0x00, 0xff }, { 0x9d, 0x00, 0xff }, { 0x9e, 0x00, 0xff }, { 0x9f, 0x00, 0xff },
- { 0xa0, 0x00, 0xff }, { 0xa2, 0x00, 0xff }, { 0xa3, 0x00, 0xff }, { 0xa4, 0x00, 0xff },
- { 0xa5, 0x00, 0xff }, { 0xa7, 0x00, 0xff }, { 0xa8, 0x00, 0xff }, { 0xa9, 0x00, 0xff },
- { 0xaa, 0x00, 0xff }, { 0xac, 0x00, 0xff }, { 0xad, 0x00, 0xff }, { 0xae, 0x00, 0xff },
- { 0xaf, 0x00, 0xff }, { 0xb1, 0x00, 0xff }, { 0xb2, 0x00, 0xff }, { 0xb3, 0x00, 0xff },
- { 0xb4, 0x00, 0xff }, { 0xb6, 0x00, 0xff }, { 0xb7, 0x00, 0xff }, { 0xb8, 0x00, 0xff },
- { 0xb9, 0x00, 0xff }, { 0xbb, 0x00, 0xff }, { 0xbc, 0x00, 0xff }, { 0xbd, 0x00, 0xff },
- { 0xbe, 0x00, 0xff }, { 0xbf, 0x00, 0xff }, { 0xc1, 0x00, 0xff }, { 0xc2, 0x00, 0xff },
- { 0xc3, 0x00, 0xff }, { 0xc4, 0x00, 0xff }, { 0xc6, 0x00, 0xff }, { 0xc7, 0x00, 0xff },
- { 0xc8, 0x00, 0xff }, { 0xc9, 0x00, 0xff }, { 0xcb, 0x00, 0xff }, { 0xcc, 0x00, 0xff },
- { 0xcd, 0x00, 0xff }, { 0xce, 0x00, 0xff }, { 0xd0, 0x00, 0xff }, { 0xd1, 0x00, 0xff },
- { 0xd2, 0x00, 0xff }, { 0xd3, 0x00, 0xff }, { 0xd5, 0x00, 0xff }, { 0xd6, 0x00, 0xff },
- { 0xd7, 0x00, 0xff }, { 0xd8, 0x00, 0xff }, { 0xda, 0x00, 0xff }, { 0xdb, 0x00, 0xff },
- { 0xdc, 0x00, 0xff }, { 0xdd, 0x00, 0xff }, { 0xdf, 0x00, 0xff }, { 0xe0, 0x00, 0xff },
- { 0xe1, 0x00, 0xff }, { 0xe2, 0x00, 0xff }, { 0xe4, 0x00, 0xff }, { 0xe5, 0x00, 0xff },
- { 0xe6, 0x00, 0xff }, { 0xe7, 0x00, 0xff }, { 0xe9, 0x00, 0xff }, { 0xea, 0x00, 0xff },
- { 0xeb, 0x00, 0xff }, { 0xec, 0x00, 0xff }, { 0xee, 0x00, 0xff }, { 0xef, 0x00, 0xff },
- { 0xf0, 0x00, 0xff }, { 0xf1, 0x00, 0xff }, { 0xf3, 0x00, 0xff }, { 0xf4, 0x00, 0xff },
- { 0xf5, 0x00, 0xff }, { 0xf6, 0x00, 0xff }, { 0xf8, 0x00, 0xff }, { 0xf9, 0x00, 0xff },
- { 0xfa, 0x00, 0xff }, { 0xfb, 0x00, 0xff }, { 0xfd, 0x00, 0xff }, { 0xfe, 0x00, 0xff },
- { 0xfc, 0x00, 0xfc }, { 0xf9, 0x00, 0xf9 }, { 0xf7, 0x00, 0xf7 }, { 0xf4, 0x00, 0xf4 },
- { 0xf2, 0x00, 0xf2 }, { 0xef, 0x00, 0xef }, { 0xed, 0x00, 0xed }, { 0xea, 0x00, 0xea },
- { 0xe8, 0x00, 0xe8 }, { 0xe5, 0x00, 0xe5 }, { 0xe2, 0x00, 0xe2 }, { 0xe0, 0x00, 0xe0 },
- { 0xdd, 0x00, 0xdd }, { 0xdb, 0x00, 0xdb }, { 0xd8, 0x00, 0xd8 }, { 0xd6, 0x00, 0xd6 },
- { 0xd3, 0x00, 0xd3 }, { 0xd1, 0x00, 0xd1 }, { 0xce, 0x00, 0xce }, { 0xcc, 0x00, 0xcc },
- { 0xc9, 0x00, 0xc9 }, { 0xc6, 0x00, 0xc6 }, { 0xc4, 0x00, 0xc4 }, { 0xc1, 0x00, 0xc1 },
- { 0xbf, 0x00, 0xbf }, { 0xbc, 0x00, 0xbc }, { 0xba, 0x00, 0xba }, { 0xb7, 0x00, 0xb7 },
- { 0xb5, 0x00, 0xb5 }, { 0xb2, 0x00, 0xb2 }, { 0xaf, 0x00, 0xaf }, { 0xad, 0x00, 0xad },
- { 0xaa, 0x00, 0xaa }, { 0xa8, 0x00, 0xa8 }, { 0xa5, 0x00, 0xa5 }, { 0xa3, 0x00, 0xa3 },
- { 0xa0, 0x00, 0xa0 }, { 0x9e, 0x00, 0x9e }, { 0x9b, 0x00, 0x9b }, { 0x99, 0x00, 0x99 },
- { 0x96, 0x00, 0x96 }, { 0x93, 0x00, 0x93 }, { 0x91, 0x00, 0x91 }, { 0x8e, 0x00, 0x8e },
- { 0x8c, 0x00, 0x8c }, { 0x89, 0x00, 0x89 }, { 0x87, 0x00, 0x87 }, { 0x84, 0x00, 0x84 },
- { 0x82, 0x00, 0x82 }, { 0x7f, 0x00, 0x7f }, { 0x7c, 0x00, 0x7c }, { 0x7a, 0x00, 0x7a },
- { 0x77, 0x00, 0x77 }, { 0x75, 0x00, 0x75 }, { 0x72, 0x00, 0x72 }, { 0x70, 0x00, 0x70 },
- { 0x6d, 0x00, 0x6d }, { 0x6b, 0x00, 0x6b }, { 0x68, 0x00, 0x68 }, { 0x66, 0x00, 0x66 },
- { 0x63, 0x00, 0x63 }, { 0x60, 0x00, 0x60 }, { 0x5e, 0x00, 0x5e }, { 0x5b, 0x00, 0x5b },
- { 0x59, 0x00, 0x59 }, { 0x56, 0x00, 0x56 }, { 0x54, 0x00, 0x54 }, { 0x51, 0x00, 0x51 },
- { 0x4f, 0x00, 0x4f }, { 0x4c, 0x00, 0x4c }, { 0x49, 0x00, 0x49 }, { 0x47, 0x00, 0x47 },
- { 0x44, 0x00, 0x44 }, { 0x42, 0x00, 0x42 }, { 0x3f, 0x00, 0x3f }, { 0x3d, 0x00, 0x3d },
- { 0x3a, 0x00, 0x3a }, { 0x38, 0x00, 0x38 }, { 0x35, 0x00, 0x35 }, { 0x33, 0x00, 0x33 },
- { 0x30, 0x00, 0x30 }, { 0x2d, 0x00, 0x2d }, { 0x2b, 0x00, 0x2b }, { 0x28, 0x00, 0x28 },
- { 0x26, 0x00, 0x26 }, { 0x23, 0x00, 0x23 }, { 0x21, 0x00, 0x21 }, { 0x1e, 0x00, 0x1e },
- { 0x1c, 0x00, 0x1c }, { 0x19, 0x00, 0x19 }, { 0x16, 0x00, 0x16 }, { 0x14, 0x00, 0x14 },
- { 0x11, 0x00, 0x11 }, { 0x0f, 0x00, 0x0f }, { 0x0c, 0x00, 0x0c }, { 0x0a, 0x00, 0x0a },
- { 0x07, 0x00, 0x07 }, { 0x05, 0x00, 0x05 }, { 0x02, 0x00, 0x02 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
- { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00 },
-};
+/* Red fades in over 100 steps, the hue then sweeps from red to
+   magenta over 1024 steps, and magenta fades out over 100 steps */
+static uint32_t Rainbow_Colour(unsigned h)
+{
+  unsigned level;
+  if (h <= 924 || h >= 2147)
+    return 0;
+  else if (h < 1024) {
+    level = (h - 924) * 255 / 100;
+    return EFFECT_RGB(level, 0, 0);
+  } else if (h < 2048)
+    return EFFECT_HueToRGB(((h - 1024) * 1275 + 512) >> 10);
+  else {
+    level = (2147 - h) * 255 / 100;
+    return EFFECT_RGB(level, 0, level);
+  }
+}
 
 void EFFECT_Rainbow(void *buf, uint32_t delay)
 {
@@ -911,16 +30,15 @@ void EFFECT_Rainbow(void *buf, uint32_t delay)
   static uint32_t travel;
   travel += delay;
   for (column = 0; column <= LED_COLUMN_MAX; column ++) {
-    const uint8_t *xs = EFFECT_GetLedColumnXs(column);
-    const uint8_t *ys = EFFECT_GetLedColumnYs(column);
+    const LAYOUT_LedTypeDef *led = &LAYOUT_Leds[column << 4];
     uint8_t rgb[16*3];
-    for (row = 0; row < 16; row++) {
-      uint8_t x = *xs++;
-      uint8_t y = *ys++;
-      uint16_t h = (y << 3) + sintab[((x << 3) + (travel >> 2)) & 1023];
-      rgb[row] = rainbow[h].r;
-      rgb[row+16] = rainbow[h].g;
-      rgb[row+32] = rainbow[h].b;
+    for (row = 0; row < 16; row++, led++) {
+      uint8_t x = led->x;
+      uint8_t y = led->y;
+      uint32_t c = Rainbow_Colour((y << 3) + EFFECT_Wave((x << 3) + (travel >> 2)));
+      rgb[row] = EFFECT_RGB_R(c);
+      rgb[row+16] = EFFECT_RGB_G(c);
+      rgb[row+32] = EFFECT_RGB_B(c);
     }
     LED_Set_ColumnEffect(buf, column, rgb);
   }
@@ -0,0 +1,90 @@
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stm32f4xx.h>
+
+#include "effect.h"
+#include "led.h"
+#include "key.h"
+#include "layout.h"
+
+/* Band levels are kept in 8.8 fixed point and move towards the last
+   reported magnitude by 1/2^shift of the difference every ms */
+#define SPECTRUM_BANDS_MAX    32
+#define SPECTRUM_ATTACK_SHIFT 2
+#define SPECTRUM_DECAY_SHIFT  6
+#define SPECTRUM_TIMEOUT_MS   250
+
+static uint8_t Spectrum_Target[SPECTRUM_BANDS_MAX];
+static uint16_t Spectrum_Level[SPECTRUM_BANDS_MAX];
+static volatile uint8_t Spectrum_Bands;
+static volatile uint32_t Spectrum_LastReport;
+
+/* report[0] is the number of bands, followed by one magnitude
+   (0-255) per band, lowest frequency first */
+void EFFECT_SpectrumReport(const uint8_t *report)
+{
+  unsigned n = report[0];
+  if (n > SPECTRUM_BANDS_MAX)
+    n = SPECTRUM_BANDS_MAX;
+  memcpy(Spectrum_Target, report + 1, n);
+  Spectrum_Bands = n;
+  Spectrum_LastReport = HAL_GetTick();
+}
+
+bool EFFECT_SpectrumActive(void)
+{
+  return Spectrum_Bands && HAL_GetTick() - Spectrum_LastReport < SPECTRUM_TIMEOUT_MS;
+}
+
+static void Spectrum_Smooth(unsigned n, uint32_t delay)
+{
+  unsigned i;
+  if (delay > 64)
+    delay = 64;
+  while (delay--)
+    for (i = 0; i < n; i++) {
+      int32_t diff = (Spectrum_Target[i] << 8) - Spectrum_Level[i];
+      if (diff > 0)
+        Spectrum_Level[i] += (diff + (1 << SPECTRUM_ATTACK_SHIFT) - 1) >> SPECTRUM_ATTACK_SHIFT;
+      else
+        Spectrum_Level[i] -= (-diff + (1 << SPECTRUM_DECAY_SHIFT) - 1) >> SPECTRUM_DECAY_SHIFT;
+    }
+}
+
+/* Level at horizontal position x, interpolated between bands */
+static unsigned Spectrum_LevelAt(unsigned n, uint8_t x)
+{
+  unsigned pos = x * (n - 1);
+  unsigned i = pos / 255, frac = pos % 255;
+  unsigned level = Spectrum_Level[i] * (255 - frac);
+  if (frac)
+    level += Spectrum_Level[i + 1] * frac;
+  return level / (255 << 8);
+}
+
+void EFFECT_Spectrum(void *buf, uint32_t delay)
+{
+  unsigned column, row, n = Spectrum_Bands;
+
+  if (!n)
+    return;
+  Spectrum_Smooth(n, delay);
+  for (column = 0; column <= LED_COLUMN_MAX; column ++) {
+    const LAYOUT_LedTypeDef *led = &LAYOUT_Leds[column << 4];
+    uint8_t rgb[16*3];
+    for (row = 0; row < 16; row++, led++) {
+      uint8_t x = led->x;
+      uint8_t y = led->y;
+      /* Bars grow from the bottom, green through yellow to red,
+         with a soft edge at the top */
+      int lit = ((int)Spectrum_LevelAt(n, x) - (255 - y)) * 4;
+      unsigned level = lit < 0? 0 : lit > 255? 255 : lit;
+      uint32_t c = EFFECT_HueToRGB(2 * y);
+      rgb[row] = EFFECT_RGB_R(c) * level / 255;
+      rgb[row+16] = EFFECT_RGB_G(c) * level / 255;
+      rgb[row+32] = EFFECT_RGB_B(c) * level / 255;
+    }
+    LED_Set_ColumnEffect(buf, column, rgb);
+  }
+}
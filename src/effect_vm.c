@@ -0,0 +1,359 @@
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+#include <stm32f4xx.h>
+
+#include "effect.h"
+#include "led.h"
+#include "key.h"
+#include "settings.h"
+#include "layout.h"
+
+/*
+ * Effect programs are evaluated once per LED per frame by a small
+ * stack machine.  Values are 32 bit signed integers; the value left
+ * on top of the stack is the colour, as 0xRRGGBB.  There are no
+ * jumps, so the cost of running a program is fixed by its length,
+ * and programs are checked for stack depth and cost when loaded so
+ * that the interpreter itself needs no checks.
+ *
+ * tools/effectvm.py assembles, emulates and uploads programs.
+ */
+
+enum {
+  VM_OP_PUSH8  = 0x01,  /* imm8, zero extended */
+  VM_OP_PUSH16 = 0x02,  /* imm16 LE, sign extended */
+  VM_OP_PUSH32 = 0x03,  /* imm32 LE */
+  VM_OP_X      = 0x08,  /* LED x position, 0-255 */
+  VM_OP_Y      = 0x09,  /* LED y position, 0-255 */
+  VM_OP_T      = 0x0a,  /* time in ms */
+  VM_OP_KEY    = 0x0b,  /* 1 if the key under the LED is down */
+  VM_OP_DUP    = 0x10,
+  VM_OP_DROP   = 0x11,
+  VM_OP_SWAP   = 0x12,
+  VM_OP_OVER   = 0x13,
+  VM_OP_ADD    = 0x20,
+  VM_OP_SUB    = 0x21,
+  VM_OP_MUL    = 0x22,
+  VM_OP_DIV    = 0x23,  /* x/0 = 0 */
+  VM_OP_MOD    = 0x24,  /* x%0 = 0 */
+  VM_OP_AND    = 0x25,
+  VM_OP_OR     = 0x26,
+  VM_OP_XOR    = 0x27,
+  VM_OP_SHL    = 0x28,
+  VM_OP_SHR    = 0x29,  /* arithmetic */
+  VM_OP_MIN    = 0x2a,
+  VM_OP_MAX    = 0x2b,
+  VM_OP_LT     = 0x2c,
+  VM_OP_EQ     = 0x2d,
+  VM_OP_NEG    = 0x30,
+  VM_OP_NOT    = 0x31,
+  VM_OP_SEL    = 0x38,  /* c a b -- c? a : b */
+  VM_OP_WAVE   = 0x40,  /* EFFECT_Wave() */
+  VM_OP_HUE    = 0x41,  /* EFFECT_HueToRGB() */
+  VM_OP_RGB    = 0x42,  /* r g b -- 0xRRGGBB, each clamped to 0-255 */
+  VM_OP_COUNT
+};
+
+#define VM_VALID  1
+#define VM_PURE   2
+#define VM_PUSH   4
+
+static const struct {
+  uint8_t in, out, imm, flags;
+} VM_OpInfo[VM_OP_COUNT] = {
+  [VM_OP_PUSH8]  = { 0, 1, 1, VM_VALID|VM_PUSH },
+  [VM_OP_PUSH16] = { 0, 1, 2, VM_VALID|VM_PUSH },
+  [VM_OP_PUSH32] = { 0, 1, 4, VM_VALID|VM_PUSH },
+  [VM_OP_X]      = { 0, 1, 0, VM_VALID },
+  [VM_OP_Y]      = { 0, 1, 0, VM_VALID },
+  [VM_OP_T]      = { 0, 1, 0, VM_VALID },
+  [VM_OP_KEY]    = { 0, 1, 0, VM_VALID },
+  [VM_OP_DUP]    = { 1, 2, 0, VM_VALID },
+  [VM_OP_DROP]   = { 1, 0, 0, VM_VALID },
+  [VM_OP_SWAP]   = { 2, 2, 0, VM_VALID },
+  [VM_OP_OVER]   = { 2, 3, 0, VM_VALID },
+  [VM_OP_ADD]    = { 2, 1, 0, VM_VALID|VM_PURE },
+  [VM_OP_SUB]    = { 2, 1, 0, VM_VALID|VM_PURE },
+  [VM_OP_MUL]    = { 2, 1, 0, VM_VALID|VM_PURE },
+  [VM_OP_DIV]    = { 2, 1, 0, VM_VALID|VM_PURE },
+  [VM_OP_MOD]    = { 2, 1, 0, VM_VALID|VM_PURE },
+  [VM_OP_AND]    = { 2, 1, 0, VM_VALID|VM_PURE },
+  [VM_OP_OR]     = { 2, 1, 0, VM_VALID|VM_PURE },
+  [VM_OP_XOR]    = { 2, 1, 0, VM_VALID|VM_PURE },
+  [VM_OP_SHL]    = { 2, 1, 0, VM_VALID|VM_PURE },
+  [VM_OP_SHR]    = { 2, 1, 0, VM_VALID|VM_PURE },
+  [VM_OP_MIN]    = { 2, 1, 0, VM_VALID|VM_PURE },
+  [VM_OP_MAX]    = { 2, 1, 0, VM_VALID|VM_PURE },
+  [VM_OP_LT]     = { 2, 1, 0, VM_VALID|VM_PURE },
+  [VM_OP_EQ]     = { 2, 1, 0, VM_VALID|VM_PURE },
+  [VM_OP_NEG]    = { 1, 1, 0, VM_VALID|VM_PURE },
+  [VM_OP_NOT]    = { 1, 1, 0, VM_VALID|VM_PURE },
+  [VM_OP_SEL]    = { 3, 1, 0, VM_VALID|VM_PURE },
+  [VM_OP_WAVE]   = { 1, 1, 0, VM_VALID|VM_PURE },
+  [VM_OP_HUE]    = { 1, 1, 0, VM_VALID|VM_PURE },
+  [VM_OP_RGB]    = { 3, 1, 0, VM_VALID|VM_PURE },
+};
+
+#define VM_CODE_MAX     256
+#define VM_STACK_MAX    16
+/* Instructions per frame, over all LEDs */
+#define VM_FRAME_BUDGET 16384
+
+/* The program is stored as settings, split over VM_BANKS records; an
+   empty program selects the built-in effect */
+#define VM_BANKS        2
+_Static_assert(VM_BANKS * SETTINGS_VALUE_MAX >= VM_CODE_MAX, "program does not fit its settings");
+
+typedef struct {
+  int32_t x, y, t, key;
+} VM_InputsTypeDef;
+
+static uint8_t VM_Code[VM_CODE_MAX];
+static uint16_t VM_CodeLength;
+static uint8_t VM_LedKey[LED_ID_MAX+1];
+static uint32_t VM_Upload[VM_CODE_MAX/4];
+static volatile uint16_t VM_CommitLength;
+static volatile bool VM_CommitPending;
+
+static int32_t VM_Clamp(int32_t v)
+{
+  return v < 0? 0 : v > 255? 255 : v;
+}
+
+static int32_t VM_Exec(const uint8_t *pc, const uint8_t *end, const VM_InputsTypeDef *in)
+{
+  int32_t stack[VM_STACK_MAX], *sp = stack;
+  int32_t a, b;
+
+  while (pc < end) {
+    switch (*pc++) {
+    case VM_OP_PUSH8:
+      *sp++ = pc[0];
+      pc += 1;
+      break;
+    case VM_OP_PUSH16:
+      *sp++ = (int16_t)(pc[0] | (pc[1] << 8));
+      pc += 2;
+      break;
+    case VM_OP_PUSH32:
+      *sp++ = (int32_t)(pc[0] | (pc[1] << 8) | (pc[2] << 16) | ((uint32_t)pc[3] << 24));
+      pc += 4;
+      break;
+    case VM_OP_X:    *sp++ = in->x; break;
+    case VM_OP_Y:    *sp++ = in->y; break;
+    case VM_OP_T:    *sp++ = in->t; break;
+    case VM_OP_KEY:  *sp++ = in->key; break;
+    case VM_OP_DUP:  sp[0] = sp[-1]; sp++; break;
+    case VM_OP_DROP: sp--; break;
+    case VM_OP_SWAP: a = sp[-1]; sp[-1] = sp[-2]; sp[-2] = a; break;
+    case VM_OP_OVER: sp[0] = sp[-2]; sp++; break;
+    case VM_OP_ADD:  a = *--sp; sp[-1] = (int32_t)((uint32_t)sp[-1] + (uint32_t)a); break;
+    case VM_OP_SUB:  a = *--sp; sp[-1] = (int32_t)((uint32_t)sp[-1] - (uint32_t)a); break;
+    case VM_OP_MUL:  a = *--sp; sp[-1] = (int32_t)((uint32_t)sp[-1] * (uint32_t)a); break;
+    case VM_OP_DIV:
+      a = *--sp;
+      if (a == -1)
+        sp[-1] = (int32_t)(0u - (uint32_t)sp[-1]);
+      else
+        sp[-1] = a? sp[-1] / a : 0;
+      break;
+    case VM_OP_MOD:
+      a = *--sp;
+      sp[-1] = (a && a != -1)? sp[-1] % a : 0;
+      break;
+    case VM_OP_AND:  a = *--sp; sp[-1] &= a; break;
+    case VM_OP_OR:   a = *--sp; sp[-1] |= a; break;
+    case VM_OP_XOR:  a = *--sp; sp[-1] ^= a; break;
+    case VM_OP_SHL:  a = *--sp; sp[-1] = (int32_t)((uint32_t)sp[-1] << (a & 31)); break;
+    case VM_OP_SHR:  a = *--sp; sp[-1] >>= (a & 31); break;
+    case VM_OP_MIN:  a = *--sp; if (a < sp[-1]) sp[-1] = a; break;
+    case VM_OP_MAX:  a = *--sp; if (a > sp[-1]) sp[-1] = a; break;
+    case VM_OP_LT:   a = *--sp; sp[-1] = sp[-1] < a; break;
+    case VM_OP_EQ:   a = *--sp; sp[-1] = sp[-1] == a; break;
+    case VM_OP_NEG:  sp[-1] = (int32_t)(0u - (uint32_t)sp[-1]); break;
+    case VM_OP_NOT:  sp[-1] = !sp[-1]; break;
+    case VM_OP_SEL:
+      b = *--sp;
+      a = *--sp;
+      sp[-1] = sp[-1]? a : b;
+      break;
+    case VM_OP_WAVE: sp[-1] = EFFECT_Wave(sp[-1]); break;
+    case VM_OP_HUE:  sp[-1] = EFFECT_HueToRGB((uint32_t)sp[-1]); break;
+    case VM_OP_RGB:
+      b = *--sp;
+      a = *--sp;
+      sp[-1] = EFFECT_RGB(VM_Clamp(sp[-1]), VM_Clamp(a), VM_Clamp(b));
+      break;
+    }
+  }
+  return sp[-1];
+}
+
+static unsigned VM_EmitPush(uint8_t *p, int32_t v)
+{
+  if (v >= 0 && v <= 0xff) {
+    p[0] = VM_OP_PUSH8;
+    p[1] = v;
+    return 2;
+  } else if (v >= -0x8000 && v <= 0x7fff) {
+    p[0] = VM_OP_PUSH16;
+    p[1] = v;
+    p[2] = v >> 8;
+    return 3;
+  } else {
+    p[0] = VM_OP_PUSH32;
+    p[1] = v;
+    p[2] = v >> 8;
+    p[3] = v >> 16;
+    p[4] = v >> 24;
+    return 5;
+  }
+}
+
+/* Validate a program and copy it to VM_Code, folding any operation
+   whose inputs are all constants into a single push */
+static bool VM_Compile(const uint8_t *src, unsigned len)
+{
+  unsigned pos = 0, out = 0, depth = 0, insns = 0;
+  unsigned consts = 0, const_pos[VM_STACK_MAX];
+
+  VM_CodeLength = 0;
+  while (pos < len) {
+    uint8_t op = src[pos];
+    if (op >= VM_OP_COUNT || !(VM_OpInfo[op].flags & VM_VALID))
+      return false;
+    unsigned in = VM_OpInfo[op].in, n = 1 + VM_OpInfo[op].imm;
+    if (pos + n > len || depth < in || depth - in + VM_OpInfo[op].out > VM_STACK_MAX)
+      return false;
+    depth += VM_OpInfo[op].out - in;
+
+    if ((VM_OpInfo[op].flags & VM_PURE) && consts >= in) {
+      uint8_t push[5];
+      unsigned start = const_pos[consts - in];
+      VM_Code[out] = op;
+      unsigned plen = VM_EmitPush(push, VM_Exec(&VM_Code[start], &VM_Code[out + 1], NULL));
+      if (start + plen <= out + 1) {
+        memcpy(&VM_Code[start], push, plen);
+        out = start + plen;
+        consts -= in;
+        const_pos[consts++] = start;
+        insns -= in - 1;
+        pos += n;
+        continue;
+      }
+    }
+
+    memcpy(&VM_Code[out], &src[pos], n);
+    if (VM_OpInfo[op].flags & VM_PUSH)
+      const_pos[consts++] = out;
+    else
+      consts = 0;
+    out += n;
+    pos += n;
+    insns++;
+  }
+
+  if (len && (depth < 1 || insns * (LED_ID_MAX+1) > VM_FRAME_BUDGET))
+    return false;
+  VM_CodeLength = out;
+  return true;
+}
+
+static void VM_MapKeyLED(uint8_t id, void *context)
+{
+  if (id <= LED_ID_MAX)
+    VM_LedKey[id] = (uint8_t)(uintptr_t)context;
+}
+
+/* Compile the stored program; SETTINGS_Load must have run first */
+void EFFECT_VM_Load(void)
+{
+  uint8_t code[VM_BANKS * SETTINGS_VALUE_MAX];
+  unsigned kc, bank, len = 0;
+
+  memset(VM_LedKey, 0xff, sizeof(VM_LedKey));
+  for (kc = 0; kc <= KEY_CODE_MAX; kc++)
+    LED_Do_Key_LEDs(kc, VM_MapKeyLED, (void *)(uintptr_t)kc);
+
+  for (bank = 0; bank < VM_BANKS; bank++) {
+    unsigned bank_len = SETTINGS_GetLength(SETTINGS_ID_EFFECT_0 + bank);
+    if (!SETTINGS_Get(SETTINGS_ID_EFFECT_0 + bank, code + len, bank_len))
+      break;
+    len += bank_len;
+  }
+  if (!len || len > VM_CODE_MAX || !VM_Compile(code, len))
+    VM_CodeLength = 0;
+}
+
+bool EFFECT_VM_Write(unsigned offset, const uint8_t *data, unsigned len)
+{
+  if (VM_CommitPending || offset + len > sizeof(VM_Upload))
+    return false;
+  memcpy((uint8_t *)VM_Upload + offset, data, len);
+  return true;
+}
+
+bool EFFECT_VM_Commit(unsigned len)
+{
+  if (VM_CommitPending || len > sizeof(VM_Upload))
+    return false;
+  VM_CommitLength = len;
+  VM_CommitPending = true;
+  return true;
+}
+
+/* Called from the main loop */
+void EFFECT_VM_Service(void)
+{
+  unsigned bank, offs = 0;
+
+  if (!VM_CommitPending)
+    return;
+
+  if (!VM_CommitLength || VM_Compile((const uint8_t *)VM_Upload, VM_CommitLength)) {
+    for (bank = 0; bank < VM_BANKS; bank++) {
+      unsigned len = VM_CommitLength - offs;
+      if (len > SETTINGS_VALUE_MAX)
+	len = SETTINGS_VALUE_MAX;
+      SETTINGS_Set(SETTINGS_ID_EFFECT_0 + bank, (const uint8_t *)VM_Upload + offs, len);
+      offs += len;
+    }
+  }
+
+  /* Reload, restoring the previous program if the new one was
+     rejected */
+  EFFECT_VM_Load();
+  VM_CommitPending = false;
+}
+
+bool EFFECT_Program(void *buf, uint32_t delay)
+{
+  unsigned column, row;
+  static uint32_t travel;
+  VM_InputsTypeDef in;
+
+  if (!VM_CodeLength)
+    return false;
+
+  travel += delay;
+  in.t = travel;
+  for (column = 0; column <= LED_COLUMN_MAX; column ++) {
+    const LAYOUT_LedTypeDef *led = &LAYOUT_Leds[column << 4];
+    const uint8_t *kcs = &VM_LedKey[column << 4];
+    uint8_t rgb[16*3];
+    for (row = 0; row < 16; row++, led++) {
+      in.x = led->x;
+      in.y = led->y;
+      in.key = *kcs != 0xff && KEY_CheckKeyState(*kcs);
+      kcs++;
+      uint32_t c = VM_Exec(VM_Code, VM_Code + VM_CodeLength, &in);
+      rgb[row] = EFFECT_RGB_R(c);
+      rgb[row+16] = EFFECT_RGB_G(c);
+      rgb[row+32] = EFFECT_RGB_B(c);
+    }
+    LED_Set_ColumnEffect(buf, column, rgb);
+  }
+  return true;
+}
@@ -0,0 +1,91 @@
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stm32f4xx.h>
+
+#include "health.h"
+#include "irq.h"
+
+/*
+ * Switch health statistics.  Every column the scan interrupt folds the
+ * margin of each key into its minimum, maximum and ambiguous band
+ * count, without branching, and only walks the keys that changed to
+ * count presses and bounces.  A switch on its way out shows up as
+ * bounces and a shrinking margin long before it stops working.
+ *
+ * Everything is read and cleared from the USB interrupt, which the
+ * scan cannot preempt, so a row is always read whole.
+ */
+
+_Static_assert(sizeof(HEALTH_KeyTypeDef) == 16, "health records are 16 bytes");
+
+static HEALTH_KeyTypeDef Health_Key[9][14];
+static uint32_t Health_LastEdge[9][14];
+static uint32_t Health_Passes;
+
+/* Reply to USB_VENDOR_REQ_HEALTH: passes since cleared, then the
+   keys of one row by column */
+static struct __attribute__((packed)) {
+	uint32_t passes;
+	HEALTH_KeyTypeDef key[14];
+} Health_Reply;
+
+/* Called from the scan interrupt for every column, with the new and
+   the previous key mask */
+RAMFUNC void HEALTH_Column(uint8_t column, uint16_t mask, uint16_t previous, const int16_t *sample)
+{
+	int32_t reference = sample[0];
+	uint32_t changed = mask ^ previous;
+	unsigned row;
+
+	for (row = 0; row < 9; row++) {
+		HEALTH_KeyTypeDef *key = &Health_Key[row][column];
+		int32_t margin = reference - sample[2 + row];
+
+		key->margin_min = margin < key->margin_min? margin : key->margin_min;
+		key->margin_max = margin > key->margin_max? margin : key->margin_max;
+		key->band_passes += (uint32_t)(margin + HEALTH_BAND - 1) < 2 * HEALTH_BAND - 1;
+	}
+
+	while (changed) {
+		uint32_t now = HAL_GetTick();
+		HEALTH_KeyTypeDef *key;
+
+		row = __builtin_ctz(changed);
+		changed &= changed - 1;
+		key = &Health_Key[row][column];
+		key->presses += (mask >> row) & 1;
+		if (now - Health_LastEdge[row][column] < HEALTH_BOUNCE_MS && key->bounces < 0xffff)
+			key->bounces++;
+		Health_LastEdge[row][column] = now;
+	}
+
+	if (column == 13)
+		Health_Passes++;
+}
+
+/* Called from the USB interrupt */
+const void *HEALTH_Read(unsigned row, uint16_t *len)
+{
+	if (row >= 9)
+		return NULL;
+	Health_Reply.passes = Health_Passes;
+	memcpy(Health_Reply.key, Health_Key[row], sizeof(Health_Reply.key));
+	*len = sizeof(Health_Reply);
+	return &Health_Reply;
+}
+
+/* Called from the USB interrupt, and once at start up */
+void HEALTH_Clear(void)
+{
+	unsigned row, column;
+
+	for (row = 0; row < 9; row++)
+		for (column = 0; column < 14; column++) {
+			Health_Key[row][column] = (HEALTH_KeyTypeDef){
+				.margin_min = INT16_MAX,
+				.margin_max = INT16_MIN,
+			};
+		}
+	Health_Passes = 0;
+}
@@ -0,0 +1,17 @@
+/* Statistics of one key, as returned by USB_VENDOR_REQ_HEALTH, little
+   endian.  Margins are reference minus sample, positive when down. */
+typedef struct {
+	uint32_t presses;
+	uint16_t bounces;     /* edges within HEALTH_BOUNCE_MS of the last, saturating */
+	int16_t margin_min;   /* over every sample since cleared */
+	int16_t margin_max;
+	uint16_t reserved;
+	uint32_t band_passes; /* passes with the margin inside +-HEALTH_BAND */
+} HEALTH_KeyTypeDef;
+
+#define HEALTH_BOUNCE_MS  5
+#define HEALTH_BAND       32   /* ADC counts */
+
+extern void HEALTH_Column(uint8_t column, uint16_t mask, uint16_t previous, const int16_t *sample);
+extern const void *HEALTH_Read(unsigned row, uint16_t *len);
+extern void HEALTH_Clear(void);
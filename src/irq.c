@@ -0,0 +1,52 @@
+#include <stdint.h>
+#include <stdbool.h>
+#include <stm32f4xx.h>
+
+#include "irq.h"
+#include "key.h"
+
+static volatile uint32_t IRQ_PendingJobs;
+
+static void (* const IRQ_JobHandlers[IRQ_JOB_COUNT])(void) = {
+	[IRQ_JOB_KEYS]      = KEY_ScanJob,
+	[IRQ_JOB_LOCK_LEDS] = KEY_LockLEDJob,
+};
+
+RAMFUNC void IRQ_Defer(unsigned job)
+{
+	__atomic_fetch_or(&IRQ_PendingJobs, 1u << job, __ATOMIC_RELAXED);
+	SCB->ICSR = SCB_ICSR_PENDSVSET_Msk;
+}
+
+/**
+* @brief This function handles PendSV, running the deferred jobs
+*/
+void PendSV_Handler(void)
+{
+	uint32_t jobs;
+	unsigned job;
+
+	IRQ_PROFILE_ENTER();
+	while ((jobs = __atomic_exchange_n(&IRQ_PendingJobs, 0, __ATOMIC_RELAXED)))
+		for (job = 0; jobs; job++, jobs >>= 1)
+			if (jobs & 1)
+				IRQ_JobHandlers[job]();
+	IRQ_PROFILE_EXIT(IRQ_SRC_PENDSV);
+}
+
+#ifdef IRQ_PROFILE
+
+volatile uint32_t IRQ_MaxCycles[IRQ_SRC_COUNT];
+
+/* TIM10 counts up from 0 after the update event that raises the
+   LED refresh interrupt, so its count on entry is the latency */
+volatile uint32_t IRQ_MaxLatencyLED;
+
+void IRQ_ProfileStart(void)
+{
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CYCCNT = 0;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+#endif
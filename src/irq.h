@@ -0,0 +1,66 @@
+/* Interrupt priorities, with NVIC_PRIORITYGROUP_4 (no subpriorities);
+   lower numbers preempt higher ones.  Nothing uses 0 since BASEPRI
+   cannot mask it, and IRQ_Lock(IRQ_PRIO_USB) must keep USB out. */
+#define IRQ_PRIO_USB      1   /* OTG_FS */
+#define IRQ_PRIO_SCAN     2   /* ADC DMA, key matrix scan */
+#define IRQ_PRIO_SYSTICK  3
+#define IRQ_PRIO_LED      5   /* TIM10 refresh, SPI2 DMA */
+#define IRQ_PRIO_WAKEUP   6   /* RTC wakeup timer and encoder EXTI, only used in suspend */
+#define IRQ_PRIO_PENDSV   15
+
+/* Mask interrupts of priority prio and lower, returning the previous
+   mask for IRQ_Unlock.  Unlike __disable_irq this leaves more urgent
+   interrupts running. */
+static inline uint32_t IRQ_Lock(uint32_t prio)
+{
+	uint32_t basepri = __get_BASEPRI();
+	__set_BASEPRI_MAX(prio << (8 - __NVIC_PRIO_BITS));
+	return basepri;
+}
+
+static inline void IRQ_Unlock(uint32_t basepri)
+{
+	__set_BASEPRI(basepri);
+}
+
+/* Deferred jobs, run from PendSV below every interrupt.  Interrupts
+   only record their data and call IRQ_Defer; a job requested several
+   times before PendSV gets to run is only run once. */
+enum {
+	IRQ_JOB_KEYS,        /* process a completed matrix scan */
+	IRQ_JOB_LOCK_LEDS,   /* show the host's lock LED state */
+	IRQ_JOB_COUNT
+};
+
+extern void IRQ_Defer(unsigned job);
+
+/* Code run from SRAM, copied there by the startup code (see
+   system/STM32F401XB_FLASH.ld); for hot interrupt paths only */
+#define RAMFUNC __attribute__((section(".ramfunc"), noinline))
+
+/* Build with IRQ_PROFILE=1 to record the longest time spent in each
+   handler, including any preemption, in CPU cycles */
+enum {
+	IRQ_SRC_USB,
+	IRQ_SRC_SCAN,
+	IRQ_SRC_LED,
+	IRQ_SRC_LED_DMA,
+	IRQ_SRC_PENDSV,
+	IRQ_SRC_COUNT
+};
+
+#ifdef IRQ_PROFILE
+extern volatile uint32_t IRQ_MaxCycles[IRQ_SRC_COUNT];
+extern volatile uint32_t IRQ_MaxLatencyLED;
+extern void IRQ_ProfileStart(void);
+#define IRQ_PROFILE_ENTER() uint32_t irq_profile_start = DWT->CYCCNT
+#define IRQ_PROFILE_EXIT(src) do {					\
+		uint32_t cycles = DWT->CYCCNT - irq_profile_start;	\
+		if (cycles > IRQ_MaxCycles[src])			\
+			IRQ_MaxCycles[src] = cycles;			\
+	} while(0)
+#else
+#define IRQ_ProfileStart() do { } while(0)
+#define IRQ_PROFILE_ENTER() do { } while(0)
+#define IRQ_PROFILE_EXIT(src) do { } while(0)
+#endif
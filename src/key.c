@@ -7,24 +7,40 @@
 #include "effect.h"
 #include "key.h"
 #include "usb.h"
+#include "irq.h"
+#include "keymap.h"
+#include "settings.h"
+#include "macro.h"
+#include "taphold.h"
 
-static const uint8_t KeyCodes[KEY_CODE_MAX+1] = {
-	0x3a, 0x29, 0x1f, 0x1e, 0x35, 0x14, 0x2b, 0x04, 0x39, 0x64, 0x1d, 0xe1, 0xe3, 0xe0, 0, 0,
-	0x3c, 0x3b, 0x20, 0x21, 0x08, 0x1a, 0x15, 0x16, 0x09, 0x07, 0x1b, 0x06, 0x8b, 0xe2, 0, 0,
-	0x3e, 0x3d, 0x24, 0x22, 0x23, 0x1c, 0x17, 0x0b, 0x0a, 0x05, 0x11, 0x19, 0x2c, 0x88, 0, 0,
-	0x3f, 0x40, 0x25, 0x26, 0x0c, 0x18, 0x12, 0x0d, 0x0f, 0x0e, 0x10, 0x37, 0x36, 0x8a, 0, 0,
-	0x42, 0x41, 0x2e, 0x27, 0x2d, 0x2f, 0x13, 0x30, 0x33, 0x34, 0x32, 0x38, 0xe7, 0xe6, 0, 0,
-	0x43, 0x45, 0x89, 0x44, 0x2a, 0x49, 0x4c, 0x4d, 0x31, 0x28, 0xe5, 0x87, 0x65, 0xe4, 0, 0,
-	0x48, 0x46, 0x53, 0x47, 0x4b, 0x4a, 0x5f, 0x4e, 0x5c, 0x59, 0x52, 0x51, 0x4f, 0x50, 0, 0,
-	0x00, 0x00, 0xf1, 0x00, 0x54, 0x61, 0x60, 0x5e, 0x5d, 0x5a, 0x5b, 0x62, 0x85, 0x63, 0, 0,
-	0xf3, 0x00, 0xf2, 0x00, 0x55, 0x56, 0x57, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58,
-};
+/* The scan interrupt only stores the latest mask of each column in
+   ScanKeyMask and leaves the rest to KEY_ScanJob, in PendSV, which
+   also applies the presses and releases of macros (see macro.c) and
+   feeds tap-hold keys to taphold.c, stamped with the time of the scan.
 
+   The reports and key masks are only written by KEY_ScanJob.  Other
+   contexts only read single bytes or halfwords, so none of them need
+   locking.  The dial is not part of HIDReport1: every USB SOF samples
+   the encoder, adds its movement to DialTotal and takes what has not
+   been sent yet with KEY_TakeDialDelta. */
+static volatile uint16_t ScanKeyMask[14];
+static volatile uint8_t HostLockLEDs;
+static volatile uint32_t ScanTick;
 static uint8_t HIDReport0[8];
 static uint8_t HIDReport1[8];
 static bool HIDReportOverflow;
 static uint8_t ToggleA, ToggleB;
 static uint16_t LastKeyMask[14];
+static uint8_t TapRelease;  /* usage of a tap, to release once sent */
+
+/* The encoder counts every edge, four per detent.  Movement is kept in
+   1/256ths of a high resolution step, USB_HID_DIAL_RESOLUTION steps to
+   a detent, and sped up by up to KNOB_ACCEL_MAX times when the counts
+   come in faster than one per KNOB_ACCEL_MS. */
+#define KNOB_COUNTS_PER_DETENT  4
+#define KNOB_ACCEL_MS           24
+#define KNOB_ACCEL_MAX          8
+static uint32_t DialTotal, DialSent;
 
 static bool AddKeyToReport(uint8_t kc)
 {
@@ -59,20 +75,49 @@ static bool RemoveKeyFromReport(uint8_t kc)
 	return false;
 }
 
-static void KeyDown(uint8_t kc)
+static void UsageDown(uint8_t usage)
+{
+	if (!usage)
+		;
+	else if (usage < 0xe0) {
+		if (!AddKeyToReport(usage))
+			HIDReportOverflow = true;
+	} else if (usage < 0xe8) {
+		HIDReport0[0] |= 1 << (usage & 7);
+	} else if (usage >= 0xf0 && usage < 0xf8) {
+		HIDReport1[0] |= 1 << (usage & 7);
+	}
+}
+
+static void UsageUp(uint8_t usage)
+{
+	if (!usage)
+		;
+	else if (usage < 0xe0) {
+		if (RemoveKeyFromReport(usage))
+			HIDReportOverflow = false;
+	} else if (usage < 0xe8) {
+		HIDReport0[0] &= ~(1 << (usage & 7));
+	} else if (usage >= 0xf0 && usage < 0xf8) {
+		HIDReport1[0] &= ~(1 << (usage & 7));
+	}
+}
+
+static void KeyDown(uint8_t kc, uint32_t tick)
 {
 	if (kc <= KEY_CODE_MAX) {
+		uint16_t action;
+
 		LED_Do_Key_LEDs(kc, EFFECT_Set_LED_Gradient, NULL);
-		kc = KeyCodes[kc];
-		if (!kc)
-			;
-		else if (kc < 0xe0) {
-			if (!AddKeyToReport(kc))
-				HIDReportOverflow = true;
-		} else if (kc < 0xe8) {
-			HIDReport0[0] |= 1 << (kc & 7);
-		} else if (kc >= 0xf0 && kc < 0xf8) {
-			HIDReport1[0] |= 1 << (kc & 7);
+		action = KEYMAP_Press(kc);
+		switch (KEYMAP_ACTION_TYPE(action)) {
+		case KEYMAP_TYPE_USAGE:
+			UsageDown(KEYMAP_ACTION_ARG(action));
+			break;
+		case KEYMAP_TYPE_MT:
+		case KEYMAP_TYPE_LT:
+			TAPHOLD_Start(kc, tick);
+			break;
 		}
 	}
 }
@@ -80,56 +125,129 @@ static void KeyDown(uint8_t kc)
 static void KeyUp(uint8_t kc)
 {
 	if (kc <= KEY_CODE_MAX) {
+		uint16_t action;
+
 		LED_Set_Key_RGB(kc, 0, 0, 0);
-		kc = KeyCodes[kc];
-		if (!kc)
-			;
-		else if (kc < 0xe0) {
-			if (RemoveKeyFromReport(kc))
-				HIDReportOverflow = false;
-		} else if (kc < 0xe8) {
-			HIDReport0[0] &= ~(1 << (kc & 7));
-		} else if (kc >= 0xf0 && kc < 0xf8) {
-			HIDReport1[0] &= ~(1 << (kc & 7));
-		}
+		action = KEYMAP_Release(kc);
+		if (KEYMAP_ACTION_TYPE(action) == KEYMAP_TYPE_USAGE)
+			UsageUp(KEYMAP_ACTION_ARG(action));
 	}
 }
 
-void ADC_MaskCallback(uint8_t column, uint16_t mask)
+static void TapHoldDecided(unsigned decision);
+
+static void KeyEvent(uint8_t kc, bool down, uint32_t tick)
+{
+	if (TAPHOLD_Pending())
+		TapHoldDecided(TAPHOLD_Event(kc, down, tick));
+	else if (down)
+		KeyDown(kc, tick);
+	else
+		KeyUp(kc);
+}
+
+static void TapHoldDecided(unsigned decision)
+{
+	uint16_t events[TAPHOLD_BUFFER];
+	uint32_t ticks[TAPHOLD_BUFFER];
+	uint8_t kc = TAPHOLD_GetKey();
+	unsigned i, count;
+
+	if (decision == TAPHOLD_UNDECIDED)
+		return;
+	count = TAPHOLD_TakeEvents(events, ticks);
+	if (decision == TAPHOLD_HOLD) {
+		uint16_t action = KEYMAP_Hold(kc);
+		if (KEYMAP_ACTION_TYPE(action) == KEYMAP_TYPE_USAGE)
+			UsageDown(KEYMAP_ACTION_ARG(action));
+	} else {
+		/* The key is already up; the usage is released by
+		   KEY_ScanJob once the host has collected the press */
+		if (TapRelease)
+			UsageUp(TapRelease);
+		TapRelease = KEYMAP_ACTION_ARG(KEYMAP_Tap(kc));
+		UsageDown(TapRelease);
+		LED_Set_Key_RGB(kc, 0, 0, 0);
+		KEYMAP_Release(kc);
+	}
+	for (i = 0; i < count; i++)
+		KeyEvent(events[i] & 0xff, events[i] & TAPHOLD_EVENT_DOWN, ticks[i]);
+}
+
+RAMFUNC void ADC_MaskCallback(uint8_t column, uint16_t mask)
 {
 	if (mask)
 			ToggleB = ~ToggleA;
 
-	mask ^= LastKeyMask[column];
-
-	if (mask) {
-		unsigned kc = column;
-		uint16_t new_mask = LastKeyMask[column] ^ mask;
-		LastKeyMask[column] = new_mask;
-		do {
-			if ((mask & 1)) {
-				if ((new_mask & 1))
-					KeyDown(kc);
-				else
-					KeyUp(kc);
-			}
-			mask >>= 1;
-			new_mask >>= 1;
-			kc += 0x10u;
-		} while (mask);
-	}
+	ScanKeyMask[column] = mask;
 	if (column == 13) {
-		if (HIDReportOverflow) {
-			static uint8_t overflow_report[8] = "\0\0\1\1\1\1\1\1";
-			overflow_report[0] = HIDReport0[0];
-			USB_HIDInReportSubmit(0, overflow_report);
-		} else
-			USB_HIDInReportSubmit(0, HIDReport0);
-		USB_HIDInReportSubmit(1, HIDReport1);
+		ScanTick = HAL_GetTick();
+		IRQ_Defer(IRQ_JOB_KEYS);
+	}
+}
+
+void KEY_ScanJob(void)
+{
+	uint16_t event = MACRO_TakeEvent();
+	uint32_t tick = ScanTick;
+	unsigned column;
+
+	if (event & MACRO_EVENT_PRESS)
+		UsageDown(event & 0xff);
+	else if (event & MACRO_EVENT_RELEASE)
+		UsageUp(event & 0xff);
+	if (TapRelease && USB_HIDInReportIdle(0)) {
+		UsageUp(TapRelease);
+		TapRelease = 0;
+	}
+
+	for (column = 0; column < 14; column++) {
+		uint16_t mask = ScanKeyMask[column] ^ LastKeyMask[column];
+		if (mask) {
+			unsigned kc = column;
+			uint16_t new_mask = LastKeyMask[column] ^ mask;
+			LastKeyMask[column] = new_mask;
+			do {
+				if ((mask & 1))
+					KeyEvent(kc, new_mask & 1, tick);
+				mask >>= 1;
+				new_mask >>= 1;
+				kc += 0x10u;
+			} while (mask);
+		}
 	}
+	TapHoldDecided(TAPHOLD_Timeout(tick));
+	if (HIDReportOverflow) {
+		static uint8_t overflow_report[8] = "\0\0\1\1\1\1\1\1";
+		overflow_report[0] = HIDReport0[0];
+		USB_HIDInReportSubmit(0, overflow_report);
+	} else
+		USB_HIDInReportSubmit(0, HIDReport0);
+	USB_HIDInReportSubmit(1, HIDReport1);
+}
+
+/* Acceleration factor in 1/256ths, from a running average of the
+   time between counts in 1/16 ms */
+static uint32_t KnobGain(unsigned counts)
+{
+	static uint32_t last_tick, interval;
+	uint32_t now = HAL_GetTick();
+	uint32_t elapsed = now - last_tick;
+
+	last_tick = now;
+	if (elapsed >= 255)
+		interval = 255 << 4;
+	else
+		interval += (int32_t)((elapsed << 4) / counts - interval) >> 2;
+	if (interval <= (KNOB_ACCEL_MS << 4) / KNOB_ACCEL_MAX)
+		return KNOB_ACCEL_MAX << 8;
+	if (interval >= KNOB_ACCEL_MS << 4)
+		return 1 << 8;
+	return (KNOB_ACCEL_MS << 12) / interval;
 }
 
-void TIM_EncoderCallback(uint8_t value)
+/* Called from SOF with the encoder count */
+RAMFUNC void TIM_EncoderCallback(uint8_t value)
 {
 	static uint8_t old_value;
 	int8_t delta = value - old_value;
@@ -143,10 +261,37 @@ void TIM_EncoderCallback(uint8_t value)
 	if (KEY_CheckKeyState(KEY_CODE_LIGHT))
 		LED_AdjustBrightness(delta * 2);
 	else
-		HIDReport1[2] += delta;
+		DialTotal += delta * (USB_HID_DIAL_RESOLUTION / KNOB_COUNTS_PER_DETENT) *
+			KnobGain(delta < 0? -delta : delta);
 }
 
-void USB_HIDOutReportCallback(const uint8_t *report)
+/* Called from SOF: the dial movement not yet sent, in high resolution
+   steps if the host has set the Resolution Multiplier, otherwise in
+   detents.  Whatever does not fit is left for the next report. */
+RAMFUNC int16_t KEY_TakeDialDelta(bool hires)
+{
+	unsigned shift = hires? 8 : 8 + __builtin_ctz(USB_HID_DIAL_RESOLUTION);
+	int32_t delta = (int32_t)(DialTotal - DialSent) / (1 << shift);
+
+	if (delta > INT16_MAX)
+		delta = INT16_MAX;
+	else if (delta < -INT16_MAX)
+		delta = -INT16_MAX;
+	DialSent += (uint32_t)delta << shift;
+	return delta;
+}
+
+void USB_HIDOutReportCallback(unsigned channel, const uint8_t *report)
+{
+	if (channel == 1)
+		EFFECT_SpectrumReport(report);
+	else {
+		HostLockLEDs = *report;
+		IRQ_Defer(IRQ_JOB_LOCK_LEDS);
+	}
+}
+
+void KEY_LockLEDJob(void)
 {
 	static const uint8_t LED_id[4] = {
 		LED_ID_LIGHT_NUM_LOCK,
@@ -154,7 +299,7 @@ void USB_HIDOutReportCallback(const uint8_t *report)
 		LED_ID_LIGHT_SCR_LOCK,
 		LED_ID_LIGHT_GAME_MODE
 	};
-	unsigned i, mask = *report;
+	unsigned i, mask = HostLockLEDs;
 	for (i=0; i<4; i++) {
 		if (mask & 1)
 			LED_Set_LED_RGB(LED_id[i], 0xff, 0xff, 0xff);
@@ -172,6 +317,15 @@ bool KEY_CheckRecentKeypress(void)
 	return true;
 }
 
+bool KEY_AnyKeyDown(void)
+{
+	unsigned column;
+	for (column = 0; column < 14; column++)
+		if (LastKeyMask[column])
+			return true;
+	return false;
+}
+
 bool KEY_CheckKeyState(uint8_t kc)
 {
 	unsigned column = kc & 0xf;
@@ -4,4 +4,8 @@
 #define KEY_CODE_MAX     (0x8du)
 
 extern bool KEY_CheckRecentKeypress(void);
+extern void KEY_ScanJob(void);
+extern void KEY_LockLEDJob(void);
 extern bool KEY_CheckKeyState(uint8_t kc);
+extern bool KEY_AnyKeyDown(void);
+extern int16_t KEY_TakeDialDelta(bool hires);
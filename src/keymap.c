@@ -0,0 +1,245 @@
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stm32f4xx.h>
+
+#include "key.h"
+#include "led.h"
+#include "layout.h"
+#include "settings.h"
+#include "keymap.h"
+#include "macro.h"
+#include "irq.h"
+
+/*
+ * Up to KEYMAP_LAYERS layers, each a full table of actions indexed by
+ * key code.  Keymap_KeyLayers[kc] has a bit set for every layer which
+ * has something other than KEYMAP_ACTION_TRANS for the key, so the
+ * action of a key press is found with one AND, a CLZ and one load,
+ * however many layers are active.  Layer 0 is always active and never
+ * transparent.
+ *
+ * The action found on press is remembered until release, so a key
+ * always releases what it pressed, even if the layers changed in
+ * between.
+ *
+ * Layers are uploaded over USB and stored as settings; the tables are
+ * rebuilt from the main loop, locked against the key job in PendSV.
+ */
+
+static uint16_t Keymap_Actions[KEYMAP_LAYERS][KEY_CODE_MAX+1];
+static uint8_t Keymap_KeyLayers[KEY_CODE_MAX+1];
+static uint16_t Keymap_Pressed[KEY_CODE_MAX+1];
+static uint8_t Keymap_Momentary, Keymap_Toggled;
+static volatile uint8_t Keymap_Active = 1;
+
+static uint8_t Keymap_Upload[KEYMAP_LAYER_MAX];
+static volatile uint8_t Keymap_CommitLayer;
+static volatile uint16_t Keymap_CommitLength;
+static volatile bool Keymap_CommitPending;
+
+_Static_assert(KEYMAP_LAYER_MAX >= (KEY_CODE_MAX + 1) * KEYMAP_ENTRY_SIZE,
+               "a layer must have room for every key");
+
+/* Settings id of a bank of a layer */
+static unsigned Keymap_SettingsId(unsigned layer, unsigned bank)
+{
+	return (bank? SETTINGS_ID_KEYMAP_EXT_0 : SETTINGS_ID_KEYMAP_0) + layer;
+}
+
+static bool Keymap_ValidAction(uint16_t action)
+{
+	switch (KEYMAP_ACTION_TYPE(action)) {
+	case KEYMAP_TYPE_USAGE:
+		return KEYMAP_ACTION_ARG(action) <= 0xff;
+	case KEYMAP_TYPE_MO:
+	case KEYMAP_TYPE_TG:
+		return KEYMAP_ACTION_ARG(action) < KEYMAP_LAYERS;
+	case KEYMAP_TYPE_MACRO:
+		return KEYMAP_ACTION_ARG(action) < MACRO_COUNT;
+	case KEYMAP_TYPE_MT:
+	case KEYMAP_TYPE_LT:
+		return (KEYMAP_ACTION_ARG(action) >> 8) < 8;
+	}
+	return action == KEYMAP_ACTION_TRANS;
+}
+
+static bool Keymap_ValidLayer(const uint8_t *entries, unsigned len)
+{
+	if (len % KEYMAP_ENTRY_SIZE)
+		return false;
+	for (; len; len -= KEYMAP_ENTRY_SIZE, entries += KEYMAP_ENTRY_SIZE)
+		if (entries[0] > KEY_CODE_MAX ||
+		    !Keymap_ValidAction(entries[1] | (entries[2] << 8)))
+			return false;
+	return true;
+}
+
+static void Keymap_LoadLayer(unsigned layer)
+{
+	uint8_t entries[KEYMAP_LAYER_MAX];
+	unsigned kc, bank, len = 0;
+
+	for (kc = 0; kc <= KEY_CODE_MAX; kc++)
+		Keymap_Actions[layer][kc] = layer? KEYMAP_ACTION_TRANS :
+			KEYMAP_ACTION_USAGE(LAYOUT_Keys[kc].usage);
+
+	for (bank = 0; bank < KEYMAP_BANKS; bank++) {
+		unsigned id = Keymap_SettingsId(layer, bank);
+		unsigned bank_len = SETTINGS_GetLength(id);
+		if (bank_len > KEYMAP_BANK_MAX || !SETTINGS_Get(id, entries + len, bank_len))
+			break;
+		len += bank_len;
+	}
+	if (!Keymap_ValidLayer(entries, len))
+		return;
+	for (kc = 0; kc < len; kc += KEYMAP_ENTRY_SIZE) {
+		uint16_t action = entries[kc+1] | (entries[kc+2] << 8);
+		if (layer || action != KEYMAP_ACTION_TRANS)
+			Keymap_Actions[layer][entries[kc]] = action;
+	}
+}
+
+/* Build the tables from the stored layers; SETTINGS_Load must have
+   run first */
+void KEYMAP_Load(void)
+{
+	uint32_t basepri = IRQ_Lock(IRQ_PRIO_PENDSV);
+	unsigned layer, kc;
+
+	for (layer = 0; layer < KEYMAP_LAYERS; layer++)
+		Keymap_LoadLayer(layer);
+	for (kc = 0; kc <= KEY_CODE_MAX; kc++) {
+		uint8_t mask = 1;
+		for (layer = 1; layer < KEYMAP_LAYERS; layer++)
+			if (Keymap_Actions[layer][kc] != KEYMAP_ACTION_TRANS)
+				mask |= 1 << layer;
+		Keymap_KeyLayers[kc] = mask;
+	}
+	IRQ_Unlock(basepri);
+}
+
+static uint16_t Keymap_Resolve(uint8_t kc)
+{
+	unsigned layer = 31 - __CLZ((Keymap_KeyLayers[kc] & Keymap_Active) | 1);
+	return Keymap_Actions[layer][kc];
+}
+
+static void Keymap_UpdateActive(void)
+{
+	Keymap_Active = 1 | Keymap_Momentary | Keymap_Toggled;
+}
+
+/* Called from the key job: returns the action of a newly pressed key,
+   after applying any layer change */
+uint16_t KEYMAP_Press(uint8_t kc)
+{
+	uint16_t action = Keymap_Resolve(kc);
+
+	Keymap_Pressed[kc] = action;
+	switch (KEYMAP_ACTION_TYPE(action)) {
+	case KEYMAP_TYPE_MO:
+		Keymap_Momentary |= 1 << KEYMAP_ACTION_ARG(action);
+		Keymap_UpdateActive();
+		break;
+	case KEYMAP_TYPE_TG:
+		Keymap_Toggled ^= 1 << KEYMAP_ACTION_ARG(action);
+		Keymap_UpdateActive();
+		break;
+	case KEYMAP_TYPE_MACRO:
+		MACRO_Play(KEYMAP_ACTION_ARG(action));
+		break;
+	}
+	return action;
+}
+
+/* Called from the key job: returns the action the key was pressed with */
+uint16_t KEYMAP_Release(uint8_t kc)
+{
+	uint16_t action = Keymap_Pressed[kc];
+
+	if (KEYMAP_ACTION_TYPE(action) == KEYMAP_TYPE_MO) {
+		Keymap_Momentary &= ~(1 << KEYMAP_ACTION_ARG(action));
+		Keymap_UpdateActive();
+	}
+	return action;
+}
+
+/* Called from the key job once a tap-hold key has been decided, to
+   turn its action into that of a held key, applying any layer change */
+uint16_t KEYMAP_Hold(uint8_t kc)
+{
+	uint16_t action = Keymap_Pressed[kc];
+	unsigned arg = KEYMAP_ACTION_ARG(action) >> 8;
+
+	switch (KEYMAP_ACTION_TYPE(action)) {
+	case KEYMAP_TYPE_MT:
+		action = KEYMAP_ACTION_USAGE(0xe0 | arg);
+		break;
+	case KEYMAP_TYPE_LT:
+		action = KEYMAP_ACTION_MO(arg);
+		Keymap_Momentary |= 1 << arg;
+		Keymap_UpdateActive();
+		break;
+	}
+	Keymap_Pressed[kc] = action;
+	return action;
+}
+
+/* As KEYMAP_Hold, for a tap */
+uint16_t KEYMAP_Tap(uint8_t kc)
+{
+	uint16_t action = Keymap_Pressed[kc];
+
+	switch (KEYMAP_ACTION_TYPE(action)) {
+	case KEYMAP_TYPE_MT:
+	case KEYMAP_TYPE_LT:
+		action = KEYMAP_ACTION_USAGE(KEYMAP_ACTION_ARG(action) & 0xff);
+		break;
+	}
+	Keymap_Pressed[kc] = action;
+	return action;
+}
+
+/* Mask of the active layers */
+uint8_t KEYMAP_GetLayers(void)
+{
+	return Keymap_Active;
+}
+
+bool KEYMAP_Write(unsigned offset, const uint8_t *data, unsigned len)
+{
+	if (Keymap_CommitPending || offset + len > sizeof(Keymap_Upload))
+		return false;
+	memcpy(Keymap_Upload + offset, data, len);
+	return true;
+}
+
+bool KEYMAP_Commit(unsigned layer, unsigned len)
+{
+	if (Keymap_CommitPending || layer >= KEYMAP_LAYERS ||
+	    len > sizeof(Keymap_Upload) || !Keymap_ValidLayer(Keymap_Upload, len))
+		return false;
+	Keymap_CommitLayer = layer;
+	Keymap_CommitLength = len;
+	Keymap_CommitPending = true;
+	return true;
+}
+
+/* Called from the main loop */
+void KEYMAP_Service(void)
+{
+	unsigned bank, offs = 0;
+
+	if (!Keymap_CommitPending)
+		return;
+	for (bank = 0; bank < KEYMAP_BANKS; bank++) {
+		unsigned len = Keymap_CommitLength - offs;
+		if (len > KEYMAP_BANK_MAX)
+			len = KEYMAP_BANK_MAX;
+		SETTINGS_Set(Keymap_SettingsId(Keymap_CommitLayer, bank), Keymap_Upload + offs, len);
+		offs += len;
+	}
+	KEYMAP_Load();
+	Keymap_CommitPending = false;
+}
@@ -0,0 +1,44 @@
+#define KEYMAP_LAYERS  8
+
+/* Actions are 16 bits: the type in the top four, an argument below */
+#define KEYMAP_ACTION_NONE      0x0000u
+#define KEYMAP_ACTION_TRANS     0xffffu  /* use the next active layer down */
+#define KEYMAP_ACTION_USAGE(u)  (0x0000u | (u))  /* HID usage, as in layout.txt */
+#define KEYMAP_ACTION_MO(l)     (0x1000u | (l))  /* layer on while held */
+#define KEYMAP_ACTION_TG(l)     (0x2000u | (l))  /* layer on/off on each press */
+#define KEYMAP_ACTION_MACRO(n)  (0x3000u | (n))  /* play macro n on press */
+/* Tap-hold keys send usage u when tapped; see taphold.c */
+#define KEYMAP_ACTION_MT(m, u)  (0x4000u | (m) << 8 | (u))  /* held: modifier 0xe0+m */
+#define KEYMAP_ACTION_LT(l, u)  (0x5000u | (l) << 8 | (u))  /* held: layer l */
+
+#define KEYMAP_ACTION_TYPE(a)   ((a) >> 12)
+#define KEYMAP_ACTION_ARG(a)    ((a) & 0xfffu)
+
+enum {
+	KEYMAP_TYPE_USAGE,
+	KEYMAP_TYPE_MO,
+	KEYMAP_TYPE_TG,
+	KEYMAP_TYPE_MACRO,
+	KEYMAP_TYPE_MT,
+	KEYMAP_TYPE_LT
+};
+
+/* Uploaded layers are lists of 3 byte entries: key code, then the
+   action, little endian.  Keys not listed are transparent, or on
+   layer 0, have the usage from layout.txt.  A layer is stored in
+   KEYMAP_BANKS settings records of whole entries, enough for every
+   key code. */
+#define KEYMAP_ENTRY_SIZE  3
+#define KEYMAP_BANKS       2
+#define KEYMAP_BANK_MAX    (SETTINGS_VALUE_MAX / KEYMAP_ENTRY_SIZE * KEYMAP_ENTRY_SIZE)
+#define KEYMAP_LAYER_MAX   (KEYMAP_BANKS * KEYMAP_BANK_MAX)
+
+extern void KEYMAP_Load(void);
+extern uint16_t KEYMAP_Press(uint8_t kc);
+extern uint16_t KEYMAP_Release(uint8_t kc);
+extern uint16_t KEYMAP_Hold(uint8_t kc);
+extern uint16_t KEYMAP_Tap(uint8_t kc);
+extern uint8_t KEYMAP_GetLayers(void);
+extern bool KEYMAP_Write(unsigned offset, const uint8_t *data, unsigned len);
+extern bool KEYMAP_Commit(unsigned layer, unsigned len);
+extern void KEYMAP_Service(void);
@@ -0,0 +1,29 @@
+/* Key and LED tables, generated at build time from src/layout.txt by
+   tools/layoutgen.py.  Include after led.h and key.h. */
+
+#define LAYOUT_KEY_LEDS_MAX 4
+
+/* Order in which the three pages of the LED update buffer take the
+   colours */
+enum {
+	LAYOUT_ORDER_RGB,
+	LAYOUT_ORDER_BRG,
+	LAYOUT_ORDER_GBR
+};
+
+/* One word per LED, indexed by LED id */
+typedef struct __attribute__((aligned(4))) {
+	uint8_t offs;   /* index of the LED in each page */
+	uint8_t order;  /* LAYOUT_ORDER_* */
+	uint8_t x, y;   /* position on the board, 0-255 */
+} LAYOUT_LedTypeDef;
+
+/* Indexed by key code */
+typedef struct {
+	uint8_t usage;  /* HID usage, 0 for none */
+	uint8_t led_count;
+	uint8_t led[LAYOUT_KEY_LEDS_MAX];
+} LAYOUT_KeyTypeDef;
+
+extern const LAYOUT_LedTypeDef LAYOUT_Leds[LED_ID_MAX+1];
+extern const LAYOUT_KeyTypeDef LAYOUT_Keys[KEY_CODE_MAX+1];
@@ -8,6 +8,9 @@
 
 extern void LED_IRQHandler(void);
 extern void LED_Start(void);
+extern void LED_StartTick(void);
+extern void LED_Stop(void);
+extern bool LED_IsStarted(void);
 extern void LED_Set_LED(uint8_t id, uint8_t c0, uint8_t c1, uint8_t c2);
 extern void LED_Set_LED_RGB(uint8_t id, uint8_t r, uint8_t g, uint8_t b);
 extern void LED_Set_Key_RGB(uint8_t kc, uint8_t r, uint8_t g, uint8_t b);
@@ -0,0 +1,230 @@
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stm32f4xx.h>
+
+#include "settings.h"
+#include "macro.h"
+#include "usb.h"
+#include "irq.h"
+
+/*
+ * Macro keys (KEYMAP_ACTION_MACRO) queue their macro with MACRO_Play
+ * from the key job.  The queue is drained from the USB start of frame
+ * interrupt, which steps through the current macro and hands at most
+ * one press or release per frame back to the key job through
+ * Macro_Event.  A step is only taken once the host has collected the
+ * previous report, so playback never outruns the polling rate and
+ * never drops a change, and a long macro costs nothing between frames.
+ *
+ * The queue has a single producer (PendSV) and a single consumer
+ * (SOF), so it needs no locking; neither does Macro_Event, which the
+ * player only fills when empty and the key job only empties.
+ */
+
+#define MACRO_QUEUE_SIZE  8   /* power of two */
+
+static uint8_t Macro_Data[MACRO_DATA_MAX];
+static uint16_t Macro_Start[MACRO_COUNT];
+static uint8_t Macro_Count;
+
+static volatile uint8_t Macro_Queue[MACRO_QUEUE_SIZE];
+static volatile uint8_t Macro_QueueHead, Macro_QueueTail;
+static volatile uint16_t Macro_Event;
+
+/* Player state, only touched from SOF */
+static const uint8_t *Macro_Step;
+static uint8_t Macro_Delay;
+static uint8_t Macro_TapUsage;
+static uint32_t Macro_PlayFrames;
+static uint16_t Macro_PlayReports;
+
+static volatile uint32_t Macro_Reports;
+static volatile uint16_t Macro_Rate;
+
+static uint8_t Macro_Upload[MACRO_DATA_MAX];
+static volatile uint16_t Macro_CommitLength;
+static volatile bool Macro_CommitPending;
+
+/* Check a list of macros, storing the offset of each in start if
+   given; returns the number of macros or -1 if malformed */
+static int Macro_Index(const uint8_t *data, unsigned len, uint16_t *start)
+{
+	unsigned offs = 0, n = 0;
+
+	while (offs < len) {
+		if (n == MACRO_COUNT)
+			return -1;
+		if (start)
+			start[n] = offs;
+		n++;
+		for (;;) {
+			uint8_t op = data[offs++];
+			if (op == MACRO_STEP_END)
+				break;
+			if (op > MACRO_STEP_DELAY || offs >= len ||
+			    (op == MACRO_STEP_DELAY && !data[offs]))
+				return -1;
+			if (++offs >= len)
+				return -1;
+		}
+	}
+	return n;
+}
+
+/* Load the stored macros, stopping any playback; SETTINGS_Load must
+   have run first */
+void MACRO_Load(void)
+{
+	uint32_t basepri = IRQ_Lock(IRQ_PRIO_USB);
+	unsigned bank, len = 0;
+	int count;
+
+	for (bank = 0; bank < MACRO_BANKS; bank++) {
+		unsigned bank_len = SETTINGS_GetLength(SETTINGS_ID_MACROS_0 + bank);
+		if (!SETTINGS_Get(SETTINGS_ID_MACROS_0 + bank, Macro_Data + len, bank_len))
+			break;
+		len += bank_len;
+	}
+	count = Macro_Index(Macro_Data, len, Macro_Start);
+	Macro_Count = count < 0? 0 : count;
+	Macro_QueueTail = Macro_QueueHead;
+	Macro_Step = NULL;
+	Macro_Delay = 0;
+	Macro_TapUsage = 0;
+	IRQ_Unlock(basepri);
+}
+
+/* Called from the key job: queue macro n, if there is room */
+void MACRO_Play(unsigned n)
+{
+	uint8_t head = Macro_QueueHead;
+
+	if (n >= Macro_Count || (uint8_t)(head - Macro_QueueTail) >= MACRO_QUEUE_SIZE)
+		return;
+	Macro_Queue[head % MACRO_QUEUE_SIZE] = n;
+	Macro_QueueHead = head + 1;
+}
+
+/* Called from the key job: the next press or release to apply, or 0 */
+uint16_t MACRO_TakeEvent(void)
+{
+	uint16_t event = Macro_Event;
+
+	if (event)
+		Macro_Event = 0;
+	return event;
+}
+
+static RAMFUNC void Macro_Emit(uint16_t event)
+{
+	Macro_Event = event;
+	Macro_PlayReports++;
+	Macro_Reports++;
+	IRQ_Defer(IRQ_JOB_KEYS);
+}
+
+/* Called from HAL_PCD_SOFCallback, once per 1 ms frame */
+RAMFUNC void MACRO_SOFCallback(void)
+{
+	if (!Macro_Step) {
+		uint8_t tail = Macro_QueueTail;
+		if (tail == Macro_QueueHead)
+			return;
+		Macro_Step = Macro_Data + Macro_Start[Macro_Queue[tail % MACRO_QUEUE_SIZE]];
+		Macro_QueueTail = tail + 1;
+		Macro_PlayFrames = 0;
+		Macro_PlayReports = 0;
+	}
+	Macro_PlayFrames++;
+
+	if (Macro_Delay) {
+		Macro_Delay--;
+		return;
+	}
+	if (Macro_Event || !USB_HIDInReportIdle(0) || !USB_HIDInReportIdle(1))
+		return;
+	if (Macro_TapUsage) {
+		Macro_Emit(MACRO_EVENT_RELEASE | Macro_TapUsage);
+		Macro_TapUsage = 0;
+		return;
+	}
+
+	for (;;) {
+		uint8_t op = Macro_Step[0], arg = Macro_Step[1];
+
+		switch (op) {
+		case MACRO_STEP_END:
+			Macro_Rate = Macro_PlayReports * 1000u / Macro_PlayFrames;
+			Macro_Step = NULL;
+			return;
+		case MACRO_STEP_DELAY:
+			Macro_Step += 2;
+			Macro_Delay = arg - 1;
+			return;
+		}
+		Macro_Step += 2;
+		if (!arg)
+			continue;
+		switch (op) {
+		case MACRO_STEP_TAP:
+			Macro_TapUsage = arg;
+			/* fall through */
+		case MACRO_STEP_PRESS:
+			Macro_Emit(MACRO_EVENT_PRESS | arg);
+			break;
+		case MACRO_STEP_RELEASE:
+			Macro_Emit(MACRO_EVENT_RELEASE | arg);
+			break;
+		}
+		return;
+	}
+}
+
+/* Reports sent by macros since reset */
+uint32_t MACRO_GetReportCount(void)
+{
+	return Macro_Reports;
+}
+
+/* Reports per second over the whole of the last macro played */
+uint16_t MACRO_GetRate(void)
+{
+	return Macro_Rate;
+}
+
+bool MACRO_Write(unsigned offset, const uint8_t *data, unsigned len)
+{
+	if (Macro_CommitPending || offset + len > sizeof(Macro_Upload))
+		return false;
+	memcpy(Macro_Upload + offset, data, len);
+	return true;
+}
+
+bool MACRO_Commit(unsigned len)
+{
+	if (Macro_CommitPending || len > sizeof(Macro_Upload) ||
+	    Macro_Index(Macro_Upload, len, NULL) < 0)
+		return false;
+	Macro_CommitLength = len;
+	Macro_CommitPending = true;
+	return true;
+}
+
+/* Called from the main loop */
+void MACRO_Service(void)
+{
+	unsigned bank, offs = 0;
+
+	if (!Macro_CommitPending)
+		return;
+	for (bank = 0; bank < MACRO_BANKS; bank++) {
+		unsigned len = Macro_CommitLength - offs;
+		if (len > SETTINGS_VALUE_MAX)
+			len = SETTINGS_VALUE_MAX;
+		SETTINGS_Set(SETTINGS_ID_MACROS_0 + bank, Macro_Upload + offs, len);
+		offs += len;
+	}
+	MACRO_Load();
+	Macro_CommitPending = false;
+}
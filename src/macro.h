@@ -0,0 +1,25 @@
+#define MACRO_COUNT     32
+#define MACRO_BANKS     4   /* settings records holding the macros */
+#define MACRO_DATA_MAX  (MACRO_BANKS * SETTINGS_VALUE_MAX)
+
+/* Macros are stored back to back as lists of steps, each an opcode
+   followed by one argument byte, and ended by MACRO_STEP_END */
+#define MACRO_STEP_END      0x00
+#define MACRO_STEP_PRESS    0x01  /* HID usage, as in layout.txt */
+#define MACRO_STEP_RELEASE  0x02  /* HID usage */
+#define MACRO_STEP_TAP      0x03  /* HID usage, pressed then released */
+#define MACRO_STEP_DELAY    0x04  /* 1-255 ms */
+
+/* Events handed from the player to the key job */
+#define MACRO_EVENT_PRESS    0x100u
+#define MACRO_EVENT_RELEASE  0x200u
+
+extern void MACRO_Load(void);
+extern void MACRO_Play(unsigned n);
+extern uint16_t MACRO_TakeEvent(void);
+extern void MACRO_SOFCallback(void);
+extern uint32_t MACRO_GetReportCount(void);
+extern uint16_t MACRO_GetRate(void);
+extern bool MACRO_Write(unsigned offset, const uint8_t *data, unsigned len);
+extern bool MACRO_Commit(unsigned len);
+extern void MACRO_Service(void);
@@ -1,5 +1,6 @@
 #include <stdint.h>
 #include <stdbool.h>
+#include <string.h>
 #include <stm32f4xx.h>
 #include <stm32f4xx_ll_rtc.h>
 
@@ -12,13 +13,26 @@
 #include "key.h"
 #include "usb.h"
 #include "effect.h"
+#include "settings.h"
+#include "irq.h"
+#include "clock.h"
+#include "power.h"
+#include "keymap.h"
+#include "macro.h"
+#include "taphold.h"
+#include "capture.h"
+#include "analog.h"
+#include "health.h"
 
 
 #define BLANKER_DELAY_MS 600000
+#define BOOT_KEY_DELAY_MS 20
 
 
 #define GO_TO_DFU_COOKIE 0xdf11f00d
 
+static volatile bool DFU_Requested;
+
 static void EnableRTCWrite(void)
 {
   __HAL_RCC_PWR_CLK_ENABLE();
@@ -40,12 +54,102 @@ int CheckShouldGoToDFU(void)
 
 void GoToDFU(void)
 {
+  /* Don't lose settings still waiting for SETTINGS_WRITE_DELAY_MS */
+  SETTINGS_Flush();
   EnableRTCWrite();
   LL_RTC_BAK_SetRegister(RTC, LL_RTC_BKP_DR17, GO_TO_DFU_COOKIE);
   HAL_NVIC_SystemReset();
 }
 
 
+bool USB_VendorOutCallback(uint8_t request, uint16_t value, uint16_t index, const uint8_t *data, uint16_t len)
+{
+  switch (request) {
+  case USB_VENDOR_REQ_EFFECT_WRITE:
+    return EFFECT_VM_Write(index, data, len);
+  case USB_VENDOR_REQ_EFFECT_COMMIT:
+    return EFFECT_VM_Commit(value);
+  case USB_VENDOR_REQ_KEYMAP_WRITE:
+    return KEYMAP_Write(index, data, len);
+  case USB_VENDOR_REQ_KEYMAP_COMMIT:
+    return KEYMAP_Commit(index, value);
+  case USB_VENDOR_REQ_MACRO_WRITE:
+    return MACRO_Write(index, data, len);
+  case USB_VENDOR_REQ_MACRO_COMMIT:
+    return MACRO_Commit(value);
+  case USB_VENDOR_REQ_TAPHOLD:
+    return TAPHOLD_Configure(value, index);
+  case USB_VENDOR_REQ_CAPTURE:
+    return CAPTURE_Configure(value, index);
+  case USB_VENDOR_REQ_ANALOG_WRITE:
+    return ANALOG_Write(index, data, len);
+  case USB_VENDOR_REQ_ANALOG_COMMIT:
+    return ANALOG_Commit(value);
+  case USB_VENDOR_REQ_ADC_FILTER:
+    return ADC_ConfigureFilter(value, index);
+  case USB_VENDOR_REQ_DFU:
+    DFU_Requested = true;
+    return true;
+  case USB_VENDOR_REQ_HEALTH_CLEAR:
+    HEALTH_Clear();
+    return true;
+  }
+  return false;
+}
+
+/* Layout of the USB_VENDOR_REQ_TELEMETRY reply, little endian */
+static struct __attribute__((packed)) {
+  uint16_t cpu_load;        /* 0.1 % */
+  uint16_t scan_rate;       /* matrix passes per second */
+  uint8_t scan_fast;
+  uint8_t clock_level;
+  uint32_t scan_fast_ms;
+  uint32_t scan_slow_ms;
+  uint32_t clock_ms[CLOCK_LEVEL_COUNT];
+  uint32_t macro_reports;   /* since reset */
+  uint16_t macro_rate;      /* reports per second, last macro */
+  uint32_t capture_dropped; /* ADC capture records, since reset */
+  uint16_t settle_ticks;    /* longest column dwell, TIM5 ticks */
+#ifdef IRQ_PROFILE
+  uint32_t irq_max_cycles[IRQ_SRC_COUNT];
+  uint32_t irq_max_latency_led;
+#endif
+} Telemetry;
+
+const void *USB_VendorInCallback(uint8_t request, uint16_t value, uint16_t index, uint16_t *len)
+{
+  unsigned level, column;
+
+  switch (request) {
+  case USB_VENDOR_REQ_TELEMETRY:
+    Telemetry.cpu_load = CLOCK_GetLoad();
+    Telemetry.scan_rate = ADC_GetScanRate();
+    Telemetry.scan_fast = ADC_IsFastScan();
+    Telemetry.clock_level = CLOCK_GetLevel();
+    Telemetry.scan_fast_ms = ADC_GetScanResidency(true);
+    Telemetry.scan_slow_ms = ADC_GetScanResidency(false);
+    for (level = 0; level < CLOCK_LEVEL_COUNT; level++)
+      Telemetry.clock_ms[level] = CLOCK_GetResidency(level);
+    Telemetry.macro_reports = MACRO_GetReportCount();
+    Telemetry.macro_rate = MACRO_GetRate();
+    Telemetry.capture_dropped = CAPTURE_GetDropped();
+    Telemetry.settle_ticks = 0;
+    for (column = 0; column < 14; column++)
+      if (ADC_GetDwell(column) > Telemetry.settle_ticks)
+        Telemetry.settle_ticks = ADC_GetDwell(column);
+#ifdef IRQ_PROFILE
+    memcpy(Telemetry.irq_max_cycles, (const void *)IRQ_MaxCycles, sizeof(Telemetry.irq_max_cycles));
+    Telemetry.irq_max_latency_led = IRQ_MaxLatencyLED;
+#endif
+    *len = sizeof(Telemetry);
+    return &Telemetry;
+  case USB_VENDOR_REQ_HEALTH:
+    return HEALTH_Read(index, len);
+  }
+  return NULL;
+}
+
+
 /**
   * @brief  This function is executed in case of error occurrence.
   * @param  None
@@ -74,8 +178,8 @@ void HAL_MspInit(void)
 	HAL_NVIC_SetPriority(UsageFault_IRQn, 0, 0);
 	HAL_NVIC_SetPriority(SVCall_IRQn, 0, 0);
 	HAL_NVIC_SetPriority(DebugMonitor_IRQn, 0, 0);
-	HAL_NVIC_SetPriority(PendSV_IRQn, 0, 0);
-	HAL_NVIC_SetPriority(SysTick_IRQn, 0, 0);
+	HAL_NVIC_SetPriority(PendSV_IRQn, IRQ_PRIO_PENDSV, 0);
+	HAL_NVIC_SetPriority(SysTick_IRQn, IRQ_PRIO_SYSTICK, 0);
 }
 
 /** System Clock Configuration
@@ -116,6 +220,12 @@ void SystemClock_Config(void)
 	RCC_ClkInitStruct.APB2CLKDivider = RCC_HCLK_DIV1;
 	HAL_RCC_ClockConfig(&RCC_ClkInitStruct, FLASH_LATENCY_2);
 
+	/* Run flash code through the ART accelerator regardless of what
+	   HAL_Init was configured to do */
+	__HAL_FLASH_PREFETCH_BUFFER_ENABLE();
+	__HAL_FLASH_INSTRUCTION_CACHE_ENABLE();
+	__HAL_FLASH_DATA_CACHE_ENABLE();
+
 	/**Configure clock outputs */	
 	PeriphClkInit.PeriphClockSelection = RCC_PERIPHCLK_I2S;
 	PeriphClkInit.PLLI2S.PLLI2SN = 100;
@@ -136,7 +246,7 @@ void SystemClock_Config(void)
 	HAL_SYSTICK_CLKSourceConfig(SYSTICK_CLKSOURCE_HCLK);
 
 	/* SysTick_IRQn interrupt configuration */
-	HAL_NVIC_SetPriority(SysTick_IRQn, 0, 0);
+	HAL_NVIC_SetPriority(SysTick_IRQn, IRQ_PRIO_SYSTICK, 0);
 }
 
 /** GPIO Setup
@@ -230,6 +340,7 @@ void GPIO_Setup(void)
 int main()
 {
 	HAL_Init();
+	IRQ_ProfileStart();
 	SystemClock_Config();
 	GPIO_Setup();
 	DMA_Setup();
@@ -238,42 +349,90 @@ int main()
 	TIM_Setup_TIM2();
 	TIM_Setup_TIM3();
 	TIM_Setup_TIM4();
+	TIM_Setup_TIM5();
 	TIM_Setup_TIM10();
 	TIM_Setup_TIM11();
 	USB_Setup_USB();
 	SPI_Setup_SPI2();
 	TIM_Setup_TIM9();
+	SETTINGS_Load();
+	KEYMAP_Load();
+	MACRO_Load();
+	TAPHOLD_Load();
+	ANALOG_Load();
+	ADC_Load();
+	HEALTH_Clear();
+	EFFECT_VM_Load();
 
 	uint32_t previous_tick = HAL_GetTick();
 	enum {
+		MODE_BOOT,
+		MODE_DFU,
 		MODE_NORMAL,
 		MODE_BLANKER,
-		MODE_BRIGHTNESS
-	} mode = MODE_NORMAL;
+		MODE_BRIGHTNESS,
+		MODE_SPECTRUM
+	} mode = MODE_BOOT;
+	bool calibrated_lit = false;
 
+	ADC_Calibrate();
 	ADC_Start(0);
 	LED_Start();
 	TIM_Start_Encoder();
 
-	HAL_Delay(20);
-	if (KEY_CheckKeyState(KEY_CODE_F12)) {
-	  int id;
-	  for(id=0; id<=LED_ID_MAX; id++)
-	    LED_Set_LED_RGB(id, 0xa0, 0x30, 0x00);
-	  HAL_Delay(1000);
-	  GoToDFU();
-	}
-
 	while (1)
 	{
 		uint32_t now = HAL_GetTick();
 		int32_t delay = now - previous_tick;
 		bool recent_keypress = KEY_CheckRecentKeypress();
+		EFFECT_VM_Service();
+		KEYMAP_Service();
+		MACRO_Service();
+		ANALOG_Service();
+		SETTINGS_Service(!ADC_IsFastScan());
+		CLOCK_Governor(mode != MODE_NORMAL || recent_keypress);
+		POWER_Service();
+		/* The LED supplies change how fast the columns settle;
+		   measure again, while idle, now that they are on */
+		if (!calibrated_lit && LED_IsStarted())
+			calibrated_lit = ADC_RecalibrateStep();
+		if (DFU_Requested && mode != MODE_DFU) {
+			/* From tools/update.py; MODE_DFU waits long enough
+			   for the status stage to reach the host */
+			int id;
+			for(id=0; id<=LED_ID_MAX; id++)
+				LED_Set_LED_RGB(id, 0xa0, 0x30, 0x00);
+			previous_tick = now;
+			mode = MODE_DFU;
+			continue;
+		}
 		switch (mode) {
+		case MODE_BOOT:
+			/* Give the scan time to see keys held at power on */
+			if (delay < BOOT_KEY_DELAY_MS)
+				break;
+			previous_tick = now;
+			if (KEY_CheckKeyState(KEY_CODE_F12)) {
+				int id;
+				for(id=0; id<=LED_ID_MAX; id++)
+					LED_Set_LED_RGB(id, 0xa0, 0x30, 0x00);
+				mode = MODE_DFU;
+			} else
+				mode = MODE_NORMAL;
+			continue;
+		case MODE_DFU:
+			if (!LED_IsStarted())
+				previous_tick = now;
+			else if (delay >= 1000)
+				GoToDFU();
+			break;
 		case MODE_NORMAL:
 			if (KEY_CheckKeyState(KEY_CODE_LIGHT)) {
 				mode = MODE_BRIGHTNESS;
 				continue;
+			} else if (EFFECT_SpectrumActive()) {
+				mode = MODE_SPECTRUM;
+				continue;
 			} else if (recent_keypress)
 				previous_tick = now;
 			else if (delay >= BLANKER_DELAY_MS) {
@@ -282,7 +441,7 @@ int main()
 			}
 			break;
 		case MODE_BLANKER:
-			if (recent_keypress) {
+			if (recent_keypress || EFFECT_SpectrumActive()) {
 				mode = MODE_NORMAL;
 				previous_tick = now;
 				LED_ClearEffect();
@@ -291,7 +450,8 @@ int main()
 				void *buf = LED_GetEffectBuffer();
 				if (buf) {
 					previous_tick = now;
-					EFFECT_Rainbow(buf, delay);
+					if (!EFFECT_Program(buf, delay))
+						EFFECT_Rainbow(buf, delay);
 					LED_CommitEffectBuffer(buf);
 					continue;
 				}
@@ -313,8 +473,24 @@ int main()
 				}
 			}
 			break;
+		case MODE_SPECTRUM:
+			if (KEY_CheckKeyState(KEY_CODE_LIGHT) || !EFFECT_SpectrumActive()) {
+				mode = MODE_NORMAL;
+				previous_tick = now;
+				LED_ClearEffect();
+				continue;
+			} else if (delay) {
+				void *buf = LED_GetEffectBuffer();
+				if (buf) {
+					previous_tick = now;
+					EFFECT_Spectrum(buf, delay);
+					LED_CommitEffectBuffer(buf);
+					continue;
+				}
+			}
+			break;
 		}
-		__WFI();
+		CLOCK_Sleep();
 	}
 
 	return 0;
@@ -0,0 +1,61 @@
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stm32f4xx.h>
+
+#include "error.h"
+#include "nvm.h"
+
+/* Note: while a flash erase or program operation is in progress,
+   any instruction fetch or data read from flash stalls the CPU.  The
+   vector table and most interrupt handlers are in flash too, so
+   interrupts stall as well: erasing a 16K sector, several hundred
+   milliseconds, freezes the whole keyboard, scan, USB and LED
+   refresh alike.  Programming a word takes microseconds.  Only call
+   these from the main loop while the keyboard is idle (see
+   SETTINGS_Service), and keep erases rare. */
+
+bool NVM_EraseSector(uint32_t sector)
+{
+	FLASH_EraseInitTypeDef FLASH_EraseInitStruct;
+	uint32_t sector_error;
+	HAL_StatusTypeDef result;
+
+	FLASH_EraseInitStruct.TypeErase    = FLASH_TYPEERASE_SECTORS;
+	FLASH_EraseInitStruct.Sector       = sector;
+	FLASH_EraseInitStruct.NbSectors    = 1;
+	FLASH_EraseInitStruct.VoltageRange = FLASH_VOLTAGE_RANGE_3;
+
+	HAL_FLASH_Unlock();
+	result = HAL_FLASHEx_Erase(&FLASH_EraseInitStruct, &sector_error);
+	HAL_FLASH_Lock();
+	return result == HAL_OK;
+}
+
+/* addr, data and len must all be word aligned */
+bool NVM_Program(uint32_t addr, const void *data, size_t len)
+{
+	const uint32_t *p = data;
+	HAL_StatusTypeDef result = HAL_OK;
+
+	HAL_FLASH_Unlock();
+	for (; len >= 4 && result == HAL_OK; len -= 4, addr += 4)
+		result = HAL_FLASH_Program(FLASH_TYPEPROGRAM_WORD, addr, *p++);
+	HAL_FLASH_Lock();
+	return result == HAL_OK;
+}
+
+/* CRC-32 (IEEE 802.3, reflected), pass 0 as the initial crc */
+uint32_t NVM_CRC32(uint32_t crc, const void *data, size_t len)
+{
+	const uint8_t *p = data;
+	int bit;
+
+	crc = ~crc;
+	while (len--) {
+		crc ^= *p++;
+		for (bit = 0; bit < 8; bit++)
+			crc = (crc >> 1) ^ (0xedb88320u & -(crc & 1));
+	}
+	return ~crc;
+}
@@ -0,0 +1,11 @@
+/* Flash sectors reserved for data in STM32F401XB_FLASH.ld; the
+   settings log alternates between them (see settings.c) */
+#define NVM_SETTINGS_SECTOR_0  FLASH_SECTOR_2
+#define NVM_SETTINGS_BASE_0    0x08008000u
+#define NVM_SETTINGS_SECTOR_1  FLASH_SECTOR_3
+#define NVM_SETTINGS_BASE_1    0x0800C000u
+#define NVM_SETTINGS_SIZE      0x4000u
+
+extern bool NVM_EraseSector(uint32_t sector);
+extern bool NVM_Program(uint32_t addr, const void *data, size_t len);
+extern uint32_t NVM_CRC32(uint32_t crc, const void *data, size_t len);
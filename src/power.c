@@ -0,0 +1,162 @@
+#include <stdint.h>
+#include <stdbool.h>
+#include <stm32f4xx.h>
+
+#include "power.h"
+#include "adc.h"
+#include "led.h"
+#include "key.h"
+#include "usb.h"
+#include "irq.h"
+#include "clock.h"
+
+/*
+ * While the host has the bus suspended the LED drivers are powered
+ * down and the CPU sits in STOP mode.  Every POWER_WAKE_SCAN_MS the
+ * RTC wakeup timer brings it back for a single pass of the key scan;
+ * a key down triggers remote wakeup, if the host has enabled it.  TIM3
+ * stops along with its clock, so the encoder pins (PC6, PC7) get EXTI
+ * lines for the duration, and turning the Q-knob does the same.  A
+ * resume from the host wakes the CPU through the USB EXTI line.
+ *
+ * Keys come back as soon as the clocks are restored; the LEDs take as
+ * long as LED_Start does, but that runs in the background.
+ */
+
+#define POWER_WAKE_SCAN_MS 30
+
+#define POWER_ENCODER_LINES (EXTI_IMR_MR6 | EXTI_IMR_MR7)
+
+static RTC_HandleTypeDef POWER_RTCHandle;
+static volatile bool POWER_KnobTurned;
+
+/**
+* @brief This function handles the RTC wakeup timer interrupt
+*/
+void RTC_WKUP_IRQHandler(void)
+{
+	HAL_RTCEx_WakeUpTimerIRQHandler(&POWER_RTCHandle);
+}
+
+/**
+* @brief This function handles EXTI lines 5 to 9, of which only the
+*        encoder lines are enabled, and only in suspend
+*/
+void EXTI9_5_IRQHandler(void)
+{
+	EXTI->PR = POWER_ENCODER_LINES;
+	POWER_KnobTurned = true;
+}
+
+/* The pins stay in their TIM3 alternate function; EXTI sees the input
+   whatever the mode */
+static void POWER_StartEncoderWake(void)
+{
+	__HAL_RCC_SYSCFG_CLK_ENABLE();
+	SYSCFG->EXTICR[1] = (SYSCFG->EXTICR[1] & ~(SYSCFG_EXTICR2_EXTI6 | SYSCFG_EXTICR2_EXTI7)) |
+		SYSCFG_EXTICR2_EXTI6_PC | SYSCFG_EXTICR2_EXTI7_PC;
+	EXTI->RTSR |= POWER_ENCODER_LINES;
+	EXTI->FTSR |= POWER_ENCODER_LINES;
+	EXTI->PR = POWER_ENCODER_LINES;
+	EXTI->IMR |= POWER_ENCODER_LINES;
+	POWER_KnobTurned = false;
+	HAL_NVIC_SetPriority(EXTI9_5_IRQn, IRQ_PRIO_WAKEUP, 0);
+	HAL_NVIC_EnableIRQ(EXTI9_5_IRQn);
+}
+
+static void POWER_StopEncoderWake(void)
+{
+	HAL_NVIC_DisableIRQ(EXTI9_5_IRQn);
+	EXTI->IMR &= ~POWER_ENCODER_LINES;
+	EXTI->RTSR &= ~POWER_ENCODER_LINES;
+	EXTI->FTSR &= ~POWER_ENCODER_LINES;
+}
+
+static void POWER_StartWakeTimer(void)
+{
+	uint32_t rtcsel;
+
+	/* Clock the RTC from the LSI unless something else was chosen */
+	HAL_PWR_EnableBkUpAccess();
+	rtcsel = RCC->BDCR & RCC_BDCR_RTCSEL;
+	if (!rtcsel || rtcsel == RCC_RTCCLKSOURCE_LSI) {
+		__HAL_RCC_LSI_ENABLE();
+		while (!__HAL_RCC_GET_FLAG(RCC_FLAG_LSIRDY))
+			;
+		if (!rtcsel)
+			__HAL_RCC_RTC_CONFIG(RCC_RTCCLKSOURCE_LSI);
+	}
+	__HAL_RCC_RTC_ENABLE();
+
+	/* 32 kHz / 16 = 2 kHz */
+	POWER_RTCHandle.Instance = RTC;
+	HAL_RTCEx_SetWakeUpTimer_IT(&POWER_RTCHandle, POWER_WAKE_SCAN_MS * 2 - 1,
+				    RTC_WAKEUPCLOCK_RTCCLK_DIV16);
+	HAL_NVIC_SetPriority(RTC_WKUP_IRQn, IRQ_PRIO_WAKEUP, 0);
+	HAL_NVIC_EnableIRQ(RTC_WKUP_IRQn);
+}
+
+static void POWER_StopWakeTimer(void)
+{
+	HAL_NVIC_DisableIRQ(RTC_WKUP_IRQn);
+	HAL_RTCEx_DeactivateWakeUpTimer(&POWER_RTCHandle);
+}
+
+/* STOP mode leaves the CPU running from the HSI with HSE and both
+   PLLs off; the PLL configuration and prescalers are retained */
+static void POWER_RestoreClocks(void)
+{
+	__HAL_RCC_HSE_CONFIG(RCC_HSE_ON);
+	while (!__HAL_RCC_GET_FLAG(RCC_FLAG_HSERDY))
+		;
+	__HAL_RCC_PLL_ENABLE();
+	__HAL_RCC_PLLI2S_ENABLE();
+	while (!__HAL_RCC_GET_FLAG(RCC_FLAG_PLLRDY))
+		;
+	__HAL_RCC_SYSCLK_CONFIG(RCC_SYSCLKSOURCE_PLLCLK);
+	while (__HAL_RCC_GET_SYSCLK_SOURCE() != RCC_SYSCLKSOURCE_STATUS_PLLCLK)
+		;
+	while (!__HAL_RCC_GET_FLAG(RCC_FLAG_PLLI2SRDY))
+		;
+}
+
+static void POWER_Suspend(void)
+{
+	CLOCK_SetLevel(CLOCK_LEVEL_FULL);
+	LED_Stop();
+	ADC_Stop();
+	POWER_StartWakeTimer();
+	POWER_StartEncoderWake();
+	HAL_PWREx_EnableFlashPowerDown();
+
+	while (USB_IsSuspended()) {
+		HAL_SuspendTick();
+		HAL_PWR_EnterSTOPMode(PWR_LOWPOWERREGULATOR_ON, PWR_STOPENTRY_WFI);
+		POWER_RestoreClocks();
+		HAL_ResumeTick();
+		if (!USB_IsSuspended())
+			break;
+
+		/* One pass of the scan; the key job runs in PendSV
+		   before ADC_Stop returns */
+		ADC_Resume();
+		ADC_Stop();
+		if ((KEY_AnyKeyDown() || POWER_KnobTurned) && USB_RemoteWakeup())
+			break;
+		POWER_KnobTurned = false;
+	}
+
+	HAL_PWREx_DisableFlashPowerDown();
+	POWER_StopEncoderWake();
+	POWER_StopWakeTimer();
+	ADC_Resume();
+	LED_Start();
+}
+
+/* Called from the main loop */
+void POWER_Service(void)
+{
+	/* Let a power-up sequence finish first */
+	if (USB_IsSuspended() && LED_IsStarted())
+		POWER_Suspend();
+}
@@ -0,0 +1 @@
+extern void POWER_Service(void);
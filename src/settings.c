@@ -0,0 +1,261 @@
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+#include <stm32f4xx.h>
+
+#include "irq.h"
+#include "nvm.h"
+#include "settings.h"
+
+/*
+ * Settings are kept in RAM and logged to flash as CRC-checked records,
+ * appended word aligned.  The log alternates between two sectors, each
+ * starting with a header which is programmed last.  At boot the sector
+ * with a complete header and the newer generation is scanned once and
+ * the last record of each id wins.  When it is full, or a damaged
+ * record is found, the current value of every setting is written to
+ * the other sector, and then its header, so that until the copy is
+ * complete the old sector stays the valid one and a reset or power
+ * loss meanwhile loses nothing.
+ *
+ * SETTINGS_Set only updates RAM and may be called from an interrupt;
+ * the flash is written from the main loop once the settings have been
+ * left alone for SETTINGS_WRITE_DELAY_MS, so that e.g. turning the
+ * brightness knob produces one record rather than dozens.  Flash
+ * writes stall everything, interrupts included: a few microseconds
+ * per word programmed, and several hundred milliseconds for a sector
+ * erase (see nvm.c).  So SETTINGS_Service only touches the flash when
+ * the main loop says the keyboard is idle, and then also erases the
+ * standby sector ahead of time, so that a compaction only programs.
+ */
+
+#define SETTINGS_RECORD_MAGIC     0x5e77
+#define SETTINGS_SECTOR_MAGIC     0x5e775ec7u
+#define SETTINGS_WRITE_DELAY_MS   2000
+
+typedef struct {
+	uint32_t generation;
+	uint32_t magic;  /* programmed after generation, once the copy is complete */
+} SETTINGS_SectorTypeDef;
+
+typedef struct {
+	uint16_t magic;
+	uint8_t id;
+	uint8_t len;
+	uint32_t crc;   /* of id, len and data */
+	uint8_t data[SETTINGS_VALUE_MAX];
+} SETTINGS_RecordTypeDef;
+
+#define SETTINGS_RECORD_SIZE(len) (offsetof(SETTINGS_RecordTypeDef, data) + (((len) + 3) & ~3))
+
+static struct {
+	uint8_t len;
+	uint8_t data[SETTINGS_VALUE_MAX];
+} Settings_Value[SETTINGS_ID_COUNT];
+
+_Static_assert(SETTINGS_ID_COUNT <= 32, "Settings_Dirty has one bit per id");
+
+static const struct {
+	uint32_t sector, base;
+} Settings_Sectors[2] = {
+	{ NVM_SETTINGS_SECTOR_0, NVM_SETTINGS_BASE_0 },
+	{ NVM_SETTINGS_SECTOR_1, NVM_SETTINGS_BASE_1 }
+};
+
+static volatile uint32_t Settings_Dirty;
+static volatile uint32_t Settings_DirtyTick;
+static int Settings_Active = -1;    /* sector in use, -1 for none */
+static uint32_t Settings_Generation;
+static uint32_t Settings_FreeAddr;  /* 0 if the log needs compacting */
+static uint32_t Settings_EndAddr;
+static bool Settings_StandbyErased;  /* the sector not in use */
+
+static uint32_t Settings_CRC(const SETTINGS_RecordTypeDef *rec)
+{
+	return NVM_CRC32(NVM_CRC32(0, &rec->id, 2), rec->data, rec->len);
+}
+
+static bool Settings_Blank(uint32_t base)
+{
+	const uint32_t *word = (const uint32_t *)base;
+	unsigned i;
+
+	for (i = 0; i < NVM_SETTINGS_SIZE / 4; i++)
+		if (word[i] != 0xffffffff)
+			return false;
+	return true;
+}
+
+void SETTINGS_Load(void)
+{
+	uint32_t addr, end;
+	int i;
+
+	Settings_Active = -1;
+	Settings_FreeAddr = 0;
+	for (i = 0; i < 2; i++) {
+		const SETTINGS_SectorTypeDef *hdr = (const SETTINGS_SectorTypeDef *)Settings_Sectors[i].base;
+		if (hdr->magic == SETTINGS_SECTOR_MAGIC &&
+		    (Settings_Active < 0 || (int32_t)(hdr->generation - Settings_Generation) > 0)) {
+			Settings_Active = i;
+			Settings_Generation = hdr->generation;
+		}
+	}
+	Settings_StandbyErased = Settings_Blank(Settings_Sectors[Settings_Active == 0].base);
+	if (Settings_Active < 0)
+		return;
+
+	addr = Settings_Sectors[Settings_Active].base + sizeof(SETTINGS_SectorTypeDef);
+	end = Settings_Sectors[Settings_Active].base + NVM_SETTINGS_SIZE;
+	Settings_EndAddr = end;
+	while (addr + offsetof(SETTINGS_RecordTypeDef, data) <= end) {
+		const SETTINGS_RecordTypeDef *rec = (const SETTINGS_RecordTypeDef *)addr;
+		if (*(const uint32_t *)addr == 0xffffffff) {
+			Settings_FreeAddr = addr;
+			break;
+		}
+		if (rec->magic != SETTINGS_RECORD_MAGIC ||
+		    rec->len > SETTINGS_VALUE_MAX ||
+		    addr + SETTINGS_RECORD_SIZE(rec->len) > end ||
+		    rec->crc != Settings_CRC(rec))
+			break;
+		if (rec->id < SETTINGS_ID_COUNT) {
+			Settings_Value[rec->id].len = rec->len;
+			memcpy(Settings_Value[rec->id].data, rec->data, rec->len);
+		}
+		addr += SETTINGS_RECORD_SIZE(rec->len);
+	}
+}
+
+bool SETTINGS_Get(unsigned id, void *value, unsigned len)
+{
+	if (id >= SETTINGS_ID_COUNT || Settings_Value[id].len != len)
+		return false;
+	memcpy(value, Settings_Value[id].data, len);
+	return true;
+}
+
+/* Length of the stored value, 0 if there is none */
+unsigned SETTINGS_GetLength(unsigned id)
+{
+	return id < SETTINGS_ID_COUNT? Settings_Value[id].len : 0;
+}
+
+/* Callers run in the main loop and in the USB interrupt, so the value
+   and the dirty bits are updated with USB locked out */
+void SETTINGS_Set(unsigned id, const void *value, unsigned len)
+{
+	uint32_t basepri;
+
+	if (id >= SETTINGS_ID_COUNT || len > SETTINGS_VALUE_MAX)
+		return;
+	basepri = IRQ_Lock(IRQ_PRIO_USB);
+	if (Settings_Value[id].len != len || memcmp(Settings_Value[id].data, value, len)) {
+		Settings_Value[id].len = len;
+		memcpy(Settings_Value[id].data, value, len);
+		Settings_DirtyTick = HAL_GetTick();
+		Settings_Dirty |= 1u << id;
+	}
+	IRQ_Unlock(basepri);
+}
+
+static bool Settings_Append(unsigned id)
+{
+	SETTINGS_RecordTypeDef rec;
+	uint32_t size, basepri;
+
+	memset(&rec, 0xff, sizeof(rec));
+	rec.magic = SETTINGS_RECORD_MAGIC;
+	rec.id = id;
+	basepri = IRQ_Lock(IRQ_PRIO_USB);
+	rec.len = Settings_Value[id].len;
+	memcpy(rec.data, Settings_Value[id].data, rec.len);
+	IRQ_Unlock(basepri);
+	rec.crc = Settings_CRC(&rec);
+	size = SETTINGS_RECORD_SIZE(rec.len);
+
+	if (!Settings_FreeAddr || Settings_FreeAddr + size > Settings_EndAddr)
+		return false;
+	if (!NVM_Program(Settings_FreeAddr, &rec, size)) {
+		Settings_FreeAddr = 0;
+		return false;
+	}
+	Settings_FreeAddr += size;
+	return true;
+}
+
+static bool Settings_EraseStandby(void)
+{
+	Settings_StandbyErased = NVM_EraseSector(Settings_Sectors[Settings_Active == 0].sector);
+	return Settings_StandbyErased;
+}
+
+/* Copy every setting to the other sector, then make it the active one.
+   The sector is only erased here if SETTINGS_Service has not done it
+   already. */
+static void Settings_Compact(void)
+{
+	int target = Settings_Active == 0;
+	uint32_t base = Settings_Sectors[target].base;
+	SETTINGS_SectorTypeDef hdr;
+	unsigned id;
+
+	Settings_FreeAddr = 0;
+	if (!Settings_StandbyErased && !Settings_EraseStandby())
+		return;
+	Settings_StandbyErased = false;
+	Settings_FreeAddr = base + sizeof(hdr);
+	Settings_EndAddr = base + NVM_SETTINGS_SIZE;
+	for (id = 0; id < SETTINGS_ID_COUNT; id++)
+		if (Settings_Value[id].len && !Settings_Append(id)) {
+			Settings_FreeAddr = 0;
+			return;
+		}
+
+	hdr.generation = Settings_Generation + 1;
+	hdr.magic = SETTINGS_SECTOR_MAGIC;
+	if (!NVM_Program(base, &hdr, sizeof(hdr))) {
+		Settings_FreeAddr = 0;
+		return;
+	}
+	Settings_Active = target;
+	Settings_Generation = hdr.generation;
+}
+
+/* Write out the changed settings */
+static void Settings_Write(void)
+{
+	uint32_t dirty, basepri;
+	unsigned id;
+
+	basepri = IRQ_Lock(IRQ_PRIO_USB);
+	dirty = Settings_Dirty;
+	Settings_Dirty = 0;
+	IRQ_Unlock(basepri);
+
+	for (id = 0; id < SETTINGS_ID_COUNT; id++)
+		if ((dirty & (1u << id)) && !Settings_Append(id))
+			break;
+	if (id < SETTINGS_ID_COUNT)
+		Settings_Compact();
+}
+
+/* Called from the main loop; idle is true while nobody is typing, the
+   only time the flash is written.  One erase or one write per call. */
+void SETTINGS_Service(bool idle)
+{
+	if (!idle)
+		return;
+	if (!Settings_StandbyErased)
+		Settings_EraseStandby();
+	else if (Settings_Dirty && HAL_GetTick() - Settings_DirtyTick >= SETTINGS_WRITE_DELAY_MS)
+		Settings_Write();
+}
+
+/* Write changed settings now, idle or not, e.g. before a reset */
+void SETTINGS_Flush(void)
+{
+	if (Settings_Dirty)
+		Settings_Write();
+}
@@ -0,0 +1,25 @@
+/* Setting ids are stored in flash, so never renumber them */
+enum {
+	SETTINGS_ID_BRIGHTNESS = 0,
+	SETTINGS_ID_KEYMAP_0,   /* first bank of each layer, see keymap.c */
+	SETTINGS_ID_KEYMAP_7 = SETTINGS_ID_KEYMAP_0 + 7,
+	SETTINGS_ID_MACROS_0,   /* MACRO_BANKS of them, see macro.c */
+	SETTINGS_ID_MACROS_3 = SETTINGS_ID_MACROS_0 + 3,
+	SETTINGS_ID_TAPHOLD,
+	SETTINGS_ID_ANALOG,      /* see analog.c */
+	SETTINGS_ID_ADC_FILTER,
+	SETTINGS_ID_EFFECT_0,    /* the effect program, see effect_vm.c */
+	SETTINGS_ID_EFFECT_1,
+	SETTINGS_ID_KEYMAP_EXT_0,  /* second bank of each layer */
+	SETTINGS_ID_KEYMAP_EXT_7 = SETTINGS_ID_KEYMAP_EXT_0 + 7,
+	SETTINGS_ID_COUNT
+};
+
+#define SETTINGS_VALUE_MAX  252
+
+extern void SETTINGS_Load(void);
+extern bool SETTINGS_Get(unsigned id, void *value, unsigned len);
+extern unsigned SETTINGS_GetLength(unsigned id);
+extern void SETTINGS_Set(unsigned id, const void *value, unsigned len);
+extern void SETTINGS_Service(bool idle);
+extern void SETTINGS_Flush(void);
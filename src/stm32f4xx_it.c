@@ -38,6 +38,9 @@
 /* Includes ------------------------------------------------------------------*/
 #include <stm32f4xx_hal.h>
 #include "stm32f4xx_it.h"
+#include <stdbool.h>
+#include "led.h"
+#include "adc.h"
 
 /**
 * @brief This function handles System tick timer.
@@ -45,6 +48,8 @@
 void SysTick_Handler(void)
 {
   HAL_IncTick();
+  LED_StartTick();
+  ADC_Tick();
 }
 
 
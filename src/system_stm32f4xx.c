@@ -150,6 +150,47 @@ const uint8_t APBPrescTable[8] = {0, 0, 0, 0, 1, 2, 3, 4};
 
 extern int CheckShouldGoToDFU(void);
 
+/* Size and CRC of everything in FLASH (sector 4), patched into the
+   .bin by tools/imagecrc.py after linking.  A length of 0, as in the
+   .elf, skips the check. */
+#define IMAGE_MAGIC     0x4d494448u  /* "HDIM" */
+#define IMAGE_BASE      0x08010000u
+#define IMAGE_SIZE_MAX  0x10000u
+
+typedef struct {
+  uint32_t magic;
+  uint32_t length;  /* bytes, a multiple of 4 */
+  uint32_t crc;     /* CRC unit: CRC-32/MPEG-2 over little endian words */
+} ImageHeaderTypeDef;
+
+__attribute__((section(".image_header"), used))
+const volatile ImageHeaderTypeDef ImageHeader = { IMAGE_MAGIC, 0, 0 };
+
+/* Runs from sectors 0-1 before anything in sector 4 is called, so an
+   update interrupted after sector 4 was erased falls back to the ROM
+   bootloader instead of crashing.  Placed there by section name, not
+   only by object file, so that no build can move it into the region
+   it checks. */
+__attribute__((section(".text_lo.ImageIntact")))
+static int ImageIntact(void)
+{
+  const uint32_t *p = (const uint32_t *)IMAGE_BASE;
+  uint32_t n = ImageHeader.length / 4;
+  int ok;
+
+  if (!ImageHeader.length)
+    return 1;
+  if (ImageHeader.length > IMAGE_SIZE_MAX)
+    return 0;
+  RCC->AHB1ENR |= RCC_AHB1ENR_CRCEN;
+  CRC->CR = CRC_CR_RESET;
+  while (n--)
+    CRC->DR = *p++;
+  ok = CRC->DR == ImageHeader.crc;
+  RCC->AHB1ENR &= ~RCC_AHB1ENR_CRCEN;
+  return ok;
+}
+
 /**
   * @brief  Setup the microcontroller system
   *         Initialize the FPU setting, vector table location and External memory 
@@ -157,10 +198,11 @@ extern int CheckShouldGoToDFU(void);
   * @param  None
   * @retval None
   */
+__attribute__((section(".text_lo.SystemInit")))
 void SystemInit(void)
 {
 
-  if (CheckShouldGoToDFU()) {
+  if (!ImageIntact() || CheckShouldGoToDFU()) {
 
     __HAL_SYSCFG_REMAPMEMORY_SYSTEMFLASH();
     __asm__("ldr sp,[%0,#0]; ldr lr,[%0,#4]; bx lr" : : "r"(0x1fff0000));
@@ -0,0 +1,133 @@
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "settings.h"
+#include "taphold.h"
+
+/*
+ * Resolution of tap-hold keys, free of any hardware so that it only
+ * depends on the events it is fed.  Only one key is undecided at a
+ * time.  While it is, the key job passes every key event here with
+ * the time of the scan that saw it, and they are held back until a
+ * decision, then replayed with those times, so that a tap-hold key
+ * among them is decided as if it had not waited.  Without an
+ * undecided key the key job does not come here at all, so other keys
+ * see no extra latency.
+ *
+ * The key is a tap if released within the tapping term, and a hold
+ * once the term has passed, or earlier according to the policy
+ * flags.  The term is checked on every event and, through
+ * TAPHOLD_Timeout, on every scan pass, which runs at full rate while
+ * a key is held down.
+ */
+
+#define TAPHOLD_NO_KEY  0xff
+
+static uint16_t TapHold_TermMs = TAPHOLD_DEFAULT_TERM_MS;
+static uint8_t TapHold_Flags;
+
+static uint8_t TapHold_Key = TAPHOLD_NO_KEY;
+static uint32_t TapHold_Tick;
+static uint16_t TapHold_Events[TAPHOLD_BUFFER];
+static uint32_t TapHold_EventTicks[TAPHOLD_BUFFER];
+static uint8_t TapHold_Count;
+
+/* Settings layout: term in ms, little endian, then the flags */
+void TAPHOLD_Load(void)
+{
+	uint8_t config[3];
+
+	if (SETTINGS_Get(SETTINGS_ID_TAPHOLD, config, sizeof(config))) {
+		TapHold_TermMs = config[0] | (config[1] << 8);
+		TapHold_Flags = config[2];
+	}
+}
+
+/* May be called from an interrupt; takes effect from the next key */
+bool TAPHOLD_Configure(unsigned term_ms, unsigned flags)
+{
+	uint8_t config[3] = { term_ms, term_ms >> 8, flags };
+
+	if (!term_ms || term_ms > 0xffff ||
+	    flags & ~(TAPHOLD_PERMISSIVE_HOLD | TAPHOLD_HOLD_ON_OTHER_KEY))
+		return false;
+	TapHold_TermMs = term_ms;
+	TapHold_Flags = flags;
+	SETTINGS_Set(SETTINGS_ID_TAPHOLD, config, sizeof(config));
+	return true;
+}
+
+bool TAPHOLD_Pending(void)
+{
+	return TapHold_Key != TAPHOLD_NO_KEY;
+}
+
+/* A tap-hold key was pressed; nothing may be pending */
+void TAPHOLD_Start(uint8_t kc, uint32_t tick)
+{
+	TapHold_Key = kc;
+	TapHold_Tick = tick;
+	TapHold_Count = 0;
+}
+
+static bool TapHold_Expired(uint32_t tick)
+{
+	return tick - TapHold_Tick >= TapHold_TermMs;
+}
+
+static bool TapHold_Buffered(uint16_t event)
+{
+	unsigned i;
+
+	for (i = 0; i < TapHold_Count; i++)
+		if (TapHold_Events[i] == event)
+			return true;
+	return false;
+}
+
+/* A key event while pending.  Every event is held back, except the
+   release of the pending key when it decides a tap. */
+unsigned TAPHOLD_Event(uint8_t kc, bool down, uint32_t tick)
+{
+	if (kc == TapHold_Key && !down && !TapHold_Expired(tick))
+		return TAPHOLD_TAP;
+
+	TapHold_EventTicks[TapHold_Count] = tick;
+	TapHold_Events[TapHold_Count++] = kc | (down? TAPHOLD_EVENT_DOWN : 0);
+	if (kc == TapHold_Key || TapHold_Expired(tick) ||
+	    TapHold_Count == TAPHOLD_BUFFER)
+		return TAPHOLD_HOLD;
+	if (down && (TapHold_Flags & TAPHOLD_HOLD_ON_OTHER_KEY))
+		return TAPHOLD_HOLD;
+	/* Only keys pressed after the pending key count */
+	if (!down && (TapHold_Flags & TAPHOLD_PERMISSIVE_HOLD) &&
+	    TapHold_Buffered(kc | TAPHOLD_EVENT_DOWN))
+		return TAPHOLD_HOLD;
+	return TAPHOLD_UNDECIDED;
+}
+
+/* Called on every scan pass while pending */
+unsigned TAPHOLD_Timeout(uint32_t tick)
+{
+	return TAPHOLD_Pending() && TapHold_Expired(tick)? TAPHOLD_HOLD : TAPHOLD_UNDECIDED;
+}
+
+uint8_t TAPHOLD_GetKey(void)
+{
+	return TapHold_Key;
+}
+
+/* After a decision: ends the pending state, copying out the events
+   held back and the ticks they were seen at, oldest first, and
+   returning their number */
+unsigned TAPHOLD_TakeEvents(uint16_t *events, uint32_t *ticks)
+{
+	unsigned count = TapHold_Count;
+
+	memcpy(events, TapHold_Events, count * sizeof(*events));
+	memcpy(ticks, TapHold_EventTicks, count * sizeof(*ticks));
+	TapHold_Count = 0;
+	TapHold_Key = TAPHOLD_NO_KEY;
+	return count;
+}
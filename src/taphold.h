@@ -0,0 +1,23 @@
+/* Decisions on a tap-hold key (KEYMAP_ACTION_MT and _LT) */
+enum {
+	TAPHOLD_UNDECIDED,
+	TAPHOLD_TAP,
+	TAPHOLD_HOLD
+};
+
+/* Policy flags, besides holding for the tapping term */
+#define TAPHOLD_PERMISSIVE_HOLD    0x01  /* another key tapped while held */
+#define TAPHOLD_HOLD_ON_OTHER_KEY  0x02  /* another key pressed while held */
+
+#define TAPHOLD_DEFAULT_TERM_MS  200
+#define TAPHOLD_BUFFER           8   /* key events held back while undecided */
+#define TAPHOLD_EVENT_DOWN       0x100u  /* events are key code | this if pressed */
+
+extern void TAPHOLD_Load(void);
+extern bool TAPHOLD_Configure(unsigned term_ms, unsigned flags);
+extern bool TAPHOLD_Pending(void);
+extern void TAPHOLD_Start(uint8_t kc, uint32_t tick);
+extern unsigned TAPHOLD_Event(uint8_t kc, bool down, uint32_t tick);
+extern unsigned TAPHOLD_Timeout(uint32_t tick);
+extern uint8_t TAPHOLD_GetKey(void);
+extern unsigned TAPHOLD_TakeEvents(uint16_t *events, uint32_t *ticks);
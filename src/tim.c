@@ -1,15 +1,18 @@
 #include <stdint.h>
+#include <stdbool.h>
 #include <stm32f4xx.h>
 #include <stm32f4xx_ll_tim.h>
 
 #include "error.h"
 #include "tim.h"
 #include "led.h"
+#include "irq.h"
 
 TIM_HandleTypeDef TIM_HandleStruct_TIM1;
 TIM_HandleTypeDef TIM_HandleStruct_TIM2;
 TIM_HandleTypeDef TIM_HandleStruct_TIM3;
 TIM_HandleTypeDef TIM_HandleStruct_TIM4;
+TIM_HandleTypeDef TIM_HandleStruct_TIM5;
 TIM_HandleTypeDef TIM_HandleStruct_TIM9;
 TIM_HandleTypeDef TIM_HandleStruct_TIM10;
 TIM_HandleTypeDef TIM_HandleStruct_TIM11;
@@ -17,11 +20,18 @@ TIM_HandleTypeDef TIM_HandleStruct_TIM11;
 /**
 * @brief This function handles TIM1 update and TIM10 interrupts
 */
-void TIM1_UP_TIM10_IRQHandler(void)
+RAMFUNC void TIM1_UP_TIM10_IRQHandler(void)
 {
+	IRQ_PROFILE_ENTER();
 	if (__HAL_TIM_GET_FLAG(&TIM_HandleStruct_TIM10, TIM_FLAG_UPDATE) != RESET) {
+#ifdef IRQ_PROFILE
+		uint32_t latency = TIM10->CNT * (TIM10->PSC + 1);
+		if (latency > IRQ_MaxLatencyLED)
+			IRQ_MaxLatencyLED = latency;
+#endif
 		__HAL_TIM_CLEAR_IT(&TIM_HandleStruct_TIM10, TIM_IT_UPDATE);
 		LED_IRQHandler();
+		IRQ_PROFILE_EXIT(IRQ_SRC_LED);
 	} else {
 		HAL_TIM_IRQHandler(&TIM_HandleStruct_TIM1);
 		HAL_TIM_IRQHandler(&TIM_HandleStruct_TIM10);
@@ -29,20 +39,12 @@ void TIM1_UP_TIM10_IRQHandler(void)
 }
 
 /**
-* @brief This function handles TIM3 interrupts
+* @brief Called from the USB SOF interrupt, once per 1 ms frame: TIM3
+*        counts encoder edges by itself, so it is only read here
 */
-void TIM3_IRQHandler(void)
+RAMFUNC void TIM_SampleEncoder(void)
 {
-	HAL_TIM_IRQHandler(&TIM_HandleStruct_TIM3);
-}
-
-/**
-* @brief  Input Capture callback in non blocking mode
-*/
-void HAL_TIM_IC_CaptureCallback(TIM_HandleTypeDef *htim)
-{
-	if (htim->Instance == TIM3)
-		TIM_EncoderCallback(LL_TIM_GetCounter(htim->Instance));
+	TIM_EncoderCallback(LL_TIM_GetCounter(TIM3));
 }
 
 
@@ -99,8 +101,6 @@ void HAL_TIM_Encoder_MspInit(TIM_HandleTypeDef *htim)
 		GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_LOW;
 		GPIO_InitStruct.Alternate = GPIO_AF2_TIM3;
 		HAL_GPIO_Init(GPIOC, &GPIO_InitStruct);
-		HAL_NVIC_SetPriority(TIM3_IRQn, 0, 0);
-		HAL_NVIC_EnableIRQ(TIM3_IRQn);
 	}
 }
 
@@ -109,7 +109,7 @@ void HAL_TIM_PWM_MspInit(TIM_HandleTypeDef *htim)
 	/* Note:
 
 	   This function is non run for any PWM timers
-	   other than TIM9 because they call HAL_TIM_Base_Init()
+	   other than TIM5 and TIM9 because they call HAL_TIM_Base_Init()
 	   before the call to HAL_TIM_PWM_Init().  Therefore
 	   HAL_TIM_Base_MspInit() is ran for those instead.
 
@@ -118,7 +118,9 @@ void HAL_TIM_PWM_MspInit(TIM_HandleTypeDef *htim)
 	   is called manually.
 	*/
 
-	if (htim->Instance == TIM9) {
+	if (htim->Instance == TIM5) {
+		__HAL_RCC_TIM5_CLK_ENABLE();
+	} else if (htim->Instance == TIM9) {
 		__HAL_RCC_TIM9_CLK_ENABLE();
 	}
 }
@@ -127,7 +129,7 @@ void HAL_TIM_Base_MspInit(TIM_HandleTypeDef *htim)
 {
 	if (htim->Instance == TIM1) {
 		__HAL_RCC_TIM1_CLK_ENABLE();
-		HAL_NVIC_SetPriority(TIM1_UP_TIM10_IRQn, 0, 0);
+		HAL_NVIC_SetPriority(TIM1_UP_TIM10_IRQn, IRQ_PRIO_LED, 0);
 		HAL_NVIC_EnableIRQ(TIM1_UP_TIM10_IRQn);
 	} else if (htim->Instance == TIM2) {
 		__HAL_RCC_TIM2_CLK_ENABLE();
@@ -135,7 +137,7 @@ void HAL_TIM_Base_MspInit(TIM_HandleTypeDef *htim)
 		__HAL_RCC_TIM4_CLK_ENABLE();
 	} else if (htim->Instance == TIM10) {
 		__HAL_RCC_TIM10_CLK_ENABLE();
-		HAL_NVIC_SetPriority(TIM1_UP_TIM10_IRQn, 0, 0);
+		HAL_NVIC_SetPriority(TIM1_UP_TIM10_IRQn, IRQ_PRIO_LED, 0);
 		HAL_NVIC_EnableIRQ(TIM1_UP_TIM10_IRQn);
 	} else if (htim->Instance == TIM11) {
 		__HAL_RCC_TIM11_CLK_ENABLE();
@@ -248,16 +250,18 @@ void TIM_Setup_TIM3(void)
 	TIM_HandleStruct_TIM3.Init.Prescaler     = 0;
 	TIM_HandleStruct_TIM3.Init.CounterMode   = TIM_COUNTERMODE_UP;
 	TIM_HandleStruct_TIM3.Init.Period        = 255;
-	TIM_HandleStruct_TIM3.Init.ClockDivision = TIM_CLOCKDIVISION_DIV1;
+	/* fDTS = 84 MHz / 4; filter 0xf needs 8 samples at fDTS / 32 to
+	   agree, rejecting glitches shorter than about 12 us */
+	TIM_HandleStruct_TIM3.Init.ClockDivision = TIM_CLOCKDIVISION_DIV4;
 	TIM_Encoder_InitStruct.EncoderMode  = TIM_ENCODERMODE_TI12;
 	TIM_Encoder_InitStruct.IC1Polarity  = TIM_ICPOLARITY_RISING;
 	TIM_Encoder_InitStruct.IC1Selection = TIM_ICSELECTION_DIRECTTI;
 	TIM_Encoder_InitStruct.IC1Prescaler = TIM_ICPSC_DIV1;
-	TIM_Encoder_InitStruct.IC1Filter    = 0x0;
+	TIM_Encoder_InitStruct.IC1Filter    = 0xf;
 	TIM_Encoder_InitStruct.IC2Polarity  = TIM_ICPOLARITY_RISING;
 	TIM_Encoder_InitStruct.IC2Selection = TIM_ICSELECTION_DIRECTTI;
 	TIM_Encoder_InitStruct.IC2Prescaler = TIM_ICPSC_DIV1;
-	TIM_Encoder_InitStruct.IC2Filter    = 0x0;
+	TIM_Encoder_InitStruct.IC2Filter    = 0xf;
 	CHECK_HAL_RESULT(HAL_TIM_Encoder_Init(&TIM_HandleStruct_TIM3, &TIM_Encoder_InitStruct));
 
 	TIM_MasterConfigStruct.MasterOutputTrigger = TIM_TRGO_RESET;
@@ -303,6 +307,45 @@ void TIM_Setup_TIM4(void)
 	TIM_Config_PWM_GPIO(&TIM_HandleStruct_TIM4);
 }
 
+/** Timer TIM5 Setup: one pulse, starting each column's conversions
+    through the ADC's TIM5_CC1 trigger once the column has settled
+*/
+void TIM_Setup_TIM5(void)
+{
+	TIM_OC_InitTypeDef TIM_OC_InitStruct;
+
+	TIM_HandleStruct_TIM5.Instance           = TIM5;
+	TIM_HandleStruct_TIM5.Init.Prescaler     = 0;
+	TIM_HandleStruct_TIM5.Init.CounterMode   = TIM_COUNTERMODE_UP;
+	TIM_HandleStruct_TIM5.Init.Period        = 1;
+	TIM_HandleStruct_TIM5.Init.ClockDivision = TIM_CLOCKDIVISION_DIV1;
+	CHECK_HAL_RESULT(HAL_TIM_PWM_Init(&TIM_HandleStruct_TIM5));
+
+	/* PWM CH1, no output pin: the reference goes active, and the ADC
+	   starts, when the count reaches the compare value */
+	TIM_OC_InitStruct.OCMode     = TIM_OCMODE_PWM2;
+	TIM_OC_InitStruct.Pulse      = 1;
+	TIM_OC_InitStruct.OCPolarity = TIM_OCPOLARITY_HIGH;
+	TIM_OC_InitStruct.OCFastMode = TIM_OCFAST_DISABLE;
+	CHECK_HAL_RESULT(HAL_TIM_PWM_ConfigChannel(&TIM_HandleStruct_TIM5, &TIM_OC_InitStruct, TIM_CHANNEL_1));
+
+	/* Compare value written straight through, stop after one pulse */
+	TIM5->CCMR1 &= ~TIM_CCMR1_OC1PE;
+	TIM5->CCER |= TIM_CCER_CC1E;
+	TIM5->CR1 |= TIM_CR1_OPM;
+}
+
+/**
+* @brief Start the ADC after ticks timer clocks (11.9 ns at full speed)
+*/
+RAMFUNC void TIM_TriggerADC(uint16_t ticks)
+{
+	TIM5->CNT = 0;
+	TIM5->CCR1 = ticks + 1;
+	TIM5->ARR = ticks + 1;
+	TIM5->CR1 |= TIM_CR1_CEN;
+}
+
 /** Timer TIM9 Setup
 */
 void TIM_Setup_TIM9(void)
@@ -378,5 +421,5 @@ void TIM_Setup_TIM11(void)
 
 void TIM_Start_Encoder(void)
 {
-	HAL_TIM_Encoder_Start_IT(&TIM_HandleStruct_TIM3, TIM_CHANNEL_1);
+	HAL_TIM_Encoder_Start(&TIM_HandleStruct_TIM3, TIM_CHANNEL_ALL);
 }
@@ -2,16 +2,20 @@ extern void TIM_Setup_TIM1(void);
 extern void TIM_Setup_TIM2(void);
 extern void TIM_Setup_TIM3(void);
 extern void TIM_Setup_TIM4(void);
+extern void TIM_Setup_TIM5(void);
 extern void TIM_Setup_TIM9(void);
 extern void TIM_Setup_TIM10(void);
 extern void TIM_Setup_TIM11(void);
 extern void TIM_Start_Encoder(void);
+extern void TIM_SampleEncoder(void);
+extern void TIM_TriggerADC(uint16_t ticks);
 extern void TIM_EncoderCallback(uint8_t value);
 
 extern TIM_HandleTypeDef TIM_HandleStruct_TIM1;
 extern TIM_HandleTypeDef TIM_HandleStruct_TIM2;
 extern TIM_HandleTypeDef TIM_HandleStruct_TIM3;
 extern TIM_HandleTypeDef TIM_HandleStruct_TIM4;
+extern TIM_HandleTypeDef TIM_HandleStruct_TIM5;
 extern TIM_HandleTypeDef TIM_HandleStruct_TIM9;
 extern TIM_HandleTypeDef TIM_HandleStruct_TIM10;
 extern TIM_HandleTypeDef TIM_HandleStruct_TIM11;
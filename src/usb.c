@@ -5,6 +5,13 @@
 
 #include "error.h"
 #include "usb.h"
+#include "irq.h"
+#include "settings.h"
+#include "macro.h"
+#include "key.h"
+#include "tim.h"
+#include "capture.h"
+#include "nvm.h"
 
 enum {
 	USB_STRING_DESCR_LANG_IDS = 0,
@@ -145,15 +152,34 @@ static const uint8_t USB_ReportDescriptor1[] = {
 	0x95, 0x01,        //   Report Count (1)
 	0x81, 0x01,        //   Input (Const,Array,Abs,No Wrap,Linear,Preferred State,No Null Position)
 	0x05, 0x01,        //   Usage Page (Generic Desktop Ctrls)
-	0x09, 0x37,        //   Usage (Dial)
+	0xA1, 0x02,        //   Collection (Logical)
+	0x09, 0x48,        //     Usage (Resolution Multiplier)
+	0x15, 0x00,        //     Logical Minimum (0)
+	0x25, 0x01,        //     Logical Maximum (1)
+	0x35, 0x01,        //     Physical Minimum (1)
+	0x45, USB_HID_DIAL_RESOLUTION, //     Physical Maximum (8)
+	0x75, 0x02,        //     Report Size (2)
+	0x95, 0x01,        //     Report Count (1)
+	0xB1, 0x02,        //     Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
+	0x09, 0x38,        //     Usage (Wheel)
+	0x16, 0x01, 0x80,  //     Logical Minimum (-32767)
+	0x26, 0xFF, 0x7F,  //     Logical Maximum (32767)
+	0x35, 0x00,        //     Physical Minimum (0)
+	0x45, 0x00,        //     Physical Maximum (0)
+	0x75, 0x10,        //     Report Size (16)
+	0x95, 0x01,        //     Report Count (1)
+	0x81, 0x06,        //     Input (Data,Var,Rel,No Wrap,Linear,Preferred State,No Null Position)
+	0xC0,              //   End Collection
+	0x75, 0x06,        //   Report Size (6)
+	0x95, 0x01,        //   Report Count (1)
+	0xB1, 0x01,        //   Feature (Const,Array,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
+	0x06, 0x00, 0xFF,  //   Usage Page (Vendor Defined 0xFF00)
+	0x09, 0x01,        //   Usage (0x01)
 	0x15, 0x00,        //   Logical Minimum (0)
 	0x26, 0xFF, 0x00,  //   Logical Maximum (255)
 	0x75, 0x08,        //   Report Size (8)
-	0x95, 0x01,        //   Report Count (1)
-	0x81, 0x2A,        //   Input (Data,Var,Abs,Wrap,Linear,No Preferred State,No Null Position)
-	0x75, 0x08,        //   Report Size (8)
-	0x95, 0x01,        //   Report Count (1)
-	0x81, 0x01,        //   Input (Const,Array,Abs,No Wrap,Linear,Preferred State,No Null Position)
+	0x95, USB_HID_SPECTRUM_REPORT_SIZE, //   Report Count (33)
+	0x91, 0x02,        //   Output (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
 	0xC0,              // End Collection
 };
 
@@ -190,6 +216,8 @@ typedef struct {
 	USB_InterfaceDescriptorTypeDef interface1;
 	USB_HIDDescriptorTypeDef hid1;
 	USB_EndpointDescriptorTypeDef ep2;
+	USB_InterfaceDescriptorTypeDef interface2;
+	USB_EndpointDescriptorTypeDef ep3;
 }  __attribute__((packed)) USB_CompositeDescriptorsTypeDef;
 
 static const USB_CompositeDescriptorsTypeDef USB_ConfigurationDescriptorStruct = {
@@ -197,7 +225,7 @@ static const USB_CompositeDescriptorsTypeDef USB_ConfigurationDescriptorStruct =
 		sizeof(USB_ConfigurationDescriptorTypeDef),
 		2,
 		sizeof(USB_CompositeDescriptorsTypeDef),
-		2,  /* Two interfaces */
+		3,  /* Three interfaces */
 		1,
 		2,
 		0xa0,
@@ -257,7 +285,26 @@ static const USB_CompositeDescriptorsTypeDef USB_ConfigurationDescriptorStruct =
 		0x82,
 		0x03, /* Interrupt */
 		4,
-		16
+		1     /* dial reports from SOF, see USB_SendDial */
+	},
+	{
+		/* Interface 2: raw ADC capture, see capture.c */
+		sizeof(USB_InterfaceDescriptorTypeDef),
+		4,
+		2,
+		0,
+		1,       /* One endpoint */
+		0xff, 0, 0, /* Vendor specific */
+		3,
+	},
+	{
+		/* EP3 */
+		sizeof(USB_EndpointDescriptorTypeDef),
+		5,
+		0x83,
+		0x03, /* Interrupt */
+		64,
+		1
 	}
 };
 
@@ -274,12 +321,24 @@ typedef struct {
 		REPORT_PENDING,
 	} ReportState[2];
 	uint16_t EP0_DataInLeft;
+	uint8_t *EP0_OutBuf;
+	uint16_t EP0_OutLen, EP0_OutDone;
+	uint32_t EP0_OutCRC;
 	uint8_t Config;
+	bool Suspended;
+	bool RemoteWakeup;
 	uint8_t Protocol[2];
 	uint8_t IdleDuration[2];
 	uint16_t IdleCount[2];
 	uint8_t HIDReportIn[2][8];
+	uint8_t HIDReportDial[4];
+	CAPTURE_RecordTypeDef CapturePacket[CAPTURE_RECORDS_PER_PACKET];
+	bool CaptureBusy;
+	uint8_t ResolutionMultiplier;
 	uint8_t HIDReportOut[8];
+	uint8_t HIDReportOut1[USB_HID_SPECTRUM_REPORT_SIZE];
+	uint8_t VendorOut[USB_VENDOR_DATA_MAX + 4];
+	uint32_t FirstReportTick;
 } USB_StateTypeDef;
 
 static USB_StateTypeDef USB_StateStruct;
@@ -290,12 +349,15 @@ PCD_HandleTypeDef PCD_HandleStruct;
   * @param  None
   * @retval None
   */
-void OTG_FS_IRQHandler(void)
+RAMFUNC void OTG_FS_IRQHandler(void)
 {
+	IRQ_PROFILE_ENTER();
 	HAL_PCD_IRQHandler(&PCD_HandleStruct);
+	IRQ_PROFILE_EXIT(IRQ_SRC_USB);
 }
 
-/* CTL out transfer, len < 64 */
+/* CTL out transfer, len may be >= 64: the packets are received one by
+   one into buf, see HAL_PCD_DataOutStageCallback */
 static void USB_CtlOut(PCD_HandleTypeDef * hpcd, void *buf, size_t len)
 {
 	USB_StateTypeDef *state = hpcd->pData;
@@ -305,6 +367,10 @@ static void USB_CtlOut(PCD_HandleTypeDef * hpcd, void *buf, size_t len)
 		memset ((uint8_t *)buf + req->wLength, 0, len - req->wLength);
 		len = req->wLength;
 	}
+	state->EP0_OutBuf = buf;
+	state->EP0_OutLen = len;
+	state->EP0_OutDone = 0;
+	state->EP0_OutCRC = 0;
 	HAL_PCD_EP_Receive(hpcd, 0, (uint8_t *)buf, len);
 }
 
@@ -334,11 +400,21 @@ static bool USB_HandleStdDevSetup(PCD_HandleTypeDef * hpcd)
 	switch (req->bRequest) {
 	case 0: /* GET_STATUS */
 		if (req->wLength == 2) {
-			static uint16_t status = 0;
+			static uint16_t status;
+			status = state->RemoteWakeup? 2 : 0;
 			USB_CtlIn(hpcd, &status, sizeof(status));
 			return true;
 		}
 		break;
+	case 1: /* CLEAR_FEATURE */
+	case 3: /* SET_FEATURE */
+		if (req->wValue == 1 && req->wIndex == 0 && req->wLength == 0) {
+			/* DEVICE_REMOTE_WAKEUP */
+			state->RemoteWakeup = (req->bRequest == 3);
+			USB_CtlIn(hpcd, NULL, 0);
+			return true;
+		}
+		break;
 	case 5: /* SET_ADDRESS */
 		if (req->wIndex == 0 && req->wLength == 0 && req->wValue < 0x80) {
 			HAL_PCD_SetAddress(hpcd, req->wValue);
@@ -367,6 +443,8 @@ static bool USB_HandleStdDevSetup(PCD_HandleTypeDef * hpcd)
 				if (state->Config) {
 					HAL_PCD_EP_Open(hpcd, 0x81, sizeof(state->HIDReportIn[0]), EP_TYPE_INTR);
 					HAL_PCD_EP_Open(hpcd, 0x82, 4, EP_TYPE_INTR);
+					HAL_PCD_EP_Open(hpcd, 0x83, sizeof(state->CapturePacket), EP_TYPE_INTR);
+					state->CaptureBusy = false;
 					state->ReportState[0] = REPORT_BUSY;
 					state->ReportState[1] = REPORT_BUSY;
 					HAL_PCD_EP_Transmit(hpcd, 1, state->HIDReportIn[0], hpcd->IN_ep[1].maxpacket);
@@ -378,6 +456,7 @@ static bool USB_HandleStdDevSetup(PCD_HandleTypeDef * hpcd)
 					state->ReportState[1] = REPORT_PENDING;
 					HAL_PCD_EP_Close(hpcd, 0x81);
 					HAL_PCD_EP_Close(hpcd, 0x82);
+					HAL_PCD_EP_Close(hpcd, 0x83);
 				}
 			}
 			USB_CtlIn(hpcd, NULL, 0);
@@ -397,6 +476,9 @@ static bool USB_HandleClsIfcSetup(PCD_HandleTypeDef * hpcd)
 		if (req->wValue == 0x0100 && req->wLength <= sizeof(state->HIDReportIn[req->wIndex])) {
 			USB_CtlIn(hpcd, state->HIDReportIn[req->wIndex], sizeof(state->HIDReportIn[req->wIndex]));
 			return true;
+		} else if (req->wValue == 0x0300 && req->wIndex == 1) {
+			USB_CtlIn(hpcd, &state->ResolutionMultiplier, sizeof(state->ResolutionMultiplier));
+			return true;
 		}
 		break;
 	case 2: /* GET_IDLE */
@@ -412,9 +494,19 @@ static bool USB_HandleClsIfcSetup(PCD_HandleTypeDef * hpcd)
 		}
 		break;
 	case 9: /* SET_REPORT */
+		/* Output and feature reports are received through USB_CtlOut
+		   like vendor data, so they may span packets, but carry no
+		   CRC: their size is fixed by the report descriptor, and
+		   uploads of settings go through vendor requests */
 		if (req->wValue == 0x0200 && req->wIndex == 0 && req->wLength <= sizeof(state->HIDReportOut)) {
 			USB_CtlOut(hpcd, state->HIDReportOut, sizeof(state->HIDReportOut));
 			return true;
+		} else if (req->wValue == 0x0200 && req->wIndex == 1 && req->wLength <= sizeof(state->HIDReportOut1)) {
+			USB_CtlOut(hpcd, state->HIDReportOut1, sizeof(state->HIDReportOut1));
+			return true;
+		} else if (req->wValue == 0x0300 && req->wIndex == 1 && req->wLength == 1) {
+			USB_CtlOut(hpcd, &state->ResolutionMultiplier, sizeof(state->ResolutionMultiplier));
+			return true;
 		}
 		break;
 	case 10: /* SET_IDLE */
@@ -452,6 +544,30 @@ static bool USB_HandleStdIfcSetup(PCD_HandleTypeDef * hpcd)
 	return false;
 }
 
+static bool USB_HandleVendorDevSetup(PCD_HandleTypeDef * hpcd)
+{
+	USB_StateTypeDef *state = hpcd->pData;
+	const USB_SetupPacketTypeDef *req = (const USB_SetupPacketTypeDef *)hpcd->Setup;
+	if (req->bmRequestType & 0x80) {
+		uint16_t len = 0;
+		const void *data = USB_VendorInCallback(req->bRequest, req->wValue, req->wIndex, &len);
+		if (!data)
+			return false;
+		USB_CtlIn(hpcd, data, len);
+		return true;
+	}
+	if (req->wLength == 0) {
+		if (!USB_VendorOutCallback(req->bRequest, req->wValue, req->wIndex, NULL, 0))
+			return false;
+		USB_CtlIn(hpcd, NULL, 0);
+		return true;
+	} else if (req->wLength > 4 && req->wLength <= sizeof(state->VendorOut)) {
+		USB_CtlOut(hpcd, state->VendorOut, req->wLength);
+		return true;
+	}
+	return false;
+}
+
 /**
   * @brief  SetupStage callback.
   * @param  hpcd: PCD handle
@@ -474,6 +590,10 @@ void HAL_PCD_SetupStageCallback(PCD_HandleTypeDef * hpcd)
 		if (state->Config && req->wIndex < 2 && USB_HandleClsIfcSetup(hpcd))
 			return;
 		break;
+	case (2<<5)|0:
+		if (USB_HandleVendorDevSetup(hpcd))
+			return;
+		break;
 	}
 	HAL_PCD_EP_SetStall(hpcd, req->bmRequestType & 0x80);
 }
@@ -488,10 +608,42 @@ void HAL_PCD_DataOutStageCallback(PCD_HandleTypeDef * hpcd, uint8_t epnum)
 {
 	if (epnum == 0) {
 		USB_StateTypeDef *state = hpcd->pData;
+		const USB_SetupPacketTypeDef *req = (const USB_SetupPacketTypeDef *)hpcd->Setup;
 
 		if (state->EP0_Mode == MODE_CTLOUT) {
-			USB_HIDOutReportCallback(state->HIDReportOut);
+			bool vendor = (req->bmRequestType & 0x60) == (2<<5);
+			unsigned count = hpcd->OUT_ep[0].xfer_count;
+			unsigned offs = state->EP0_OutDone;
+
+			/* Vendor data ends in the CRC-32 of what comes before it,
+			   which is worked out packet by packet as it arrives */
+			if (vendor && offs < state->EP0_OutLen - 4u) {
+				unsigned n = state->EP0_OutLen - 4u - offs;
+				state->EP0_OutCRC = NVM_CRC32(state->EP0_OutCRC, state->EP0_OutBuf + offs,
+							      count < n? count : n);
+			}
+			state->EP0_OutDone = offs += count;
+			if (count == 64 && offs < state->EP0_OutLen) {
+				HAL_PCD_EP_Receive(hpcd, 0, state->EP0_OutBuf + offs, state->EP0_OutLen - offs);
+				return;
+			}
+
 			state->EP0_Mode = MODE_NONE;
+			if (vendor) {
+				uint32_t crc;
+				memcpy(&crc, state->VendorOut + req->wLength - 4, sizeof(crc));
+				if (offs != req->wLength || crc != state->EP0_OutCRC ||
+				    !USB_VendorOutCallback(req->bRequest, req->wValue, req->wIndex,
+							   state->VendorOut, req->wLength - 4)) {
+					HAL_PCD_EP_SetStall(hpcd, 0x80);
+					return;
+				}
+			} else if (req->wValue == 0x0300)
+				state->ResolutionMultiplier &= 1;
+			else if (req->wIndex == 1)
+				USB_HIDOutReportCallback(1, state->HIDReportOut1);
+			else
+				USB_HIDOutReportCallback(0, state->HIDReportOut);
 			HAL_PCD_EP_Transmit(hpcd, 0, NULL, 0);
 		}
 	}
@@ -503,7 +655,7 @@ void HAL_PCD_DataOutStageCallback(PCD_HandleTypeDef * hpcd, uint8_t epnum)
   * @param  epnum: Endpoint Number
   * @retval None
   */
-void HAL_PCD_DataInStageCallback(PCD_HandleTypeDef * hpcd, uint8_t epnum)
+RAMFUNC void HAL_PCD_DataInStageCallback(PCD_HandleTypeDef * hpcd, uint8_t epnum)
 {
 	USB_StateTypeDef *state = hpcd->pData;
 
@@ -521,32 +673,69 @@ void HAL_PCD_DataInStageCallback(PCD_HandleTypeDef * hpcd, uint8_t epnum)
 			HAL_PCD_EP_SetStall(hpcd, 0x80);
 			HAL_PCD_EP_Receive(hpcd, 0, NULL, 0);
 		}
+	} else if (epnum == 3) {
+		state->CaptureBusy = false;
 	} else if(epnum < 3 && state->ReportState[epnum-1] != REPORT_IDLE) {
 		bool send_pkt = false;
-		uint32_t primask_bit = __get_PRIMASK();
-		__disable_irq();
+		if (!state->FirstReportTick)
+			state->FirstReportTick = HAL_GetTick();
+		uint32_t basepri = IRQ_Lock(IRQ_PRIO_USB);
 		if (state->ReportState[epnum-1] == REPORT_PENDING) {
 			state->ReportState[epnum-1] = REPORT_BUSY;
 			state->IdleCount[epnum-1] = state->IdleDuration[epnum-1] << 2;
 			send_pkt = true;
 		} else if (state->ReportState[epnum-1] == REPORT_BUSY)
 			state->ReportState[epnum-1] = REPORT_IDLE;
-		__set_PRIMASK(primask_bit);
+		IRQ_Unlock(basepri);
 		if (send_pkt) {
 			HAL_PCD_EP_Transmit(&PCD_HandleStruct, epnum, state->HIDReportIn[epnum-1], hpcd->IN_ep[epnum].maxpacket);
 		}
 	}
 }
 
+/* Send any dial movement on interface 1 as soon as the endpoint is
+   free.  The dial is relative, so it is sent from its own buffer and
+   never repeated: HIDReportIn[1] always has it at zero, for idle
+   repeats, GET_REPORT and the next button report. */
+static RAMFUNC void USB_SendDial(PCD_HandleTypeDef *hpcd)
+{
+	USB_StateTypeDef *state = hpcd->pData;
+	int16_t delta;
+
+	if (state->ReportState[1] != REPORT_IDLE ||
+	    !(delta = KEY_TakeDialDelta(state->ResolutionMultiplier)))
+		return;
+	memcpy(state->HIDReportDial, state->HIDReportIn[1], 2);
+	state->HIDReportDial[2] = delta;
+	state->HIDReportDial[3] = delta >> 8;
+	state->ReportState[1] = REPORT_BUSY;
+	state->IdleCount[1] = state->IdleDuration[1] << 2;
+	HAL_PCD_EP_Transmit(hpcd, 2, state->HIDReportDial, sizeof(state->HIDReportDial));
+}
+
+/* Move captured samples out, one packet per frame; a host that is not
+   reading leaves the endpoint busy and the ring fills up and drops */
+static RAMFUNC void USB_SendCapture(PCD_HandleTypeDef *hpcd)
+{
+	USB_StateTypeDef *state = hpcd->pData;
+	unsigned len;
+
+	if (state->CaptureBusy || !(len = CAPTURE_Fill(state->CapturePacket)))
+		return;
+	state->CaptureBusy = true;
+	HAL_PCD_EP_Transmit(hpcd, 3, (uint8_t *)state->CapturePacket, len);
+}
+
 /**
   * @brief  USB Start Of Frame callback.
   * @param  hpcd PCD handle
   * @retval None
   */
-void HAL_PCD_SOFCallback(PCD_HandleTypeDef *hpcd)
+RAMFUNC void HAL_PCD_SOFCallback(PCD_HandleTypeDef *hpcd)
 {
 	USB_StateTypeDef *state = hpcd->pData;
 
+	TIM_SampleEncoder();
 	if (!state->Config)
 		return;
 
@@ -557,19 +746,21 @@ void HAL_PCD_SOFCallback(PCD_HandleTypeDef *hpcd)
 				--state->IdleCount[i];
 			else {
 				bool send_pkt = false;
-				uint32_t primask_bit = __get_PRIMASK();
-				__disable_irq();
+				uint32_t basepri = IRQ_Lock(IRQ_PRIO_USB);
 				if(state->ReportState[i] == REPORT_IDLE) {
 					state->ReportState[i] = REPORT_BUSY;
 					state->IdleCount[i] = state->IdleDuration[i] << 2;
 					send_pkt = true;
 				}
-				__set_PRIMASK(primask_bit);
+				IRQ_Unlock(basepri);
 				if (send_pkt) {
 					HAL_PCD_EP_Transmit(&PCD_HandleStruct, i+1, state->HIDReportIn[i], hpcd->IN_ep[i+1].maxpacket);
 				}
 			}
 		}
+	USB_SendDial(hpcd);
+	USB_SendCapture(hpcd);
+	MACRO_SOFCallback();
 }
 
 /**
@@ -582,12 +773,15 @@ void HAL_PCD_ResetCallback(PCD_HandleTypeDef * hpcd)
 	USB_StateTypeDef *state = hpcd->pData;
 
 	state->Config = 0;
+	state->Suspended = false;
+	state->RemoteWakeup = false;
 	state->IdleDuration[0] = 2;
 	state->IdleDuration[1] = 0;
 	state->IdleCount[0] = 8;
 	state->IdleCount[1] = 0;
 	state->Protocol[0] = 1;
 	state->Protocol[1] = 1;
+	state->ResolutionMultiplier = 0;
 	state->EP0_Mode = MODE_NONE;
 	state->ReportState[0] = REPORT_PENDING;
 	state->ReportState[1] = REPORT_PENDING;
@@ -602,7 +796,10 @@ void HAL_PCD_ResetCallback(PCD_HandleTypeDef * hpcd)
   */
 void HAL_PCD_SuspendCallback(PCD_HandleTypeDef * hpcd)
 {
+	USB_StateTypeDef *state = hpcd->pData;
+
 	__HAL_PCD_GATE_PHYCLOCK(hpcd);
+	state->Suspended = true;
 }
 
 /**
@@ -612,7 +809,41 @@ void HAL_PCD_SuspendCallback(PCD_HandleTypeDef * hpcd)
   */
 void HAL_PCD_ResumeCallback(PCD_HandleTypeDef * hpcd)
 {
+	USB_StateTypeDef *state = hpcd->pData;
+
 	__HAL_PCD_UNGATE_PHYCLOCK(hpcd);
+	state->Suspended = false;
+}
+
+/**
+  * @brief  This function handles the USB wakeup EXTI line, which
+  *         brings the CPU out of STOP mode when the host resumes.
+  * @param  None
+  * @retval None
+  */
+void OTG_FS_WKUP_IRQHandler(void)
+{
+	__HAL_USB_OTG_FS_WAKEUP_EXTI_CLEAR_FLAG();
+}
+
+bool USB_IsSuspended(void)
+{
+	return USB_StateStruct.Suspended;
+}
+
+/* Signal resume to a suspended host, if it has allowed us to.
+   Must be called from the main loop, as it waits for 5 ms. */
+bool USB_RemoteWakeup(void)
+{
+	USB_StateTypeDef *state = &USB_StateStruct;
+
+	if (!state->Suspended || !state->RemoteWakeup)
+		return false;
+	__HAL_PCD_UNGATE_PHYCLOCK(&PCD_HandleStruct);
+	HAL_PCD_ActivateRemoteWakeup(&PCD_HandleStruct);
+	HAL_Delay(5);
+	HAL_PCD_DeActivateRemoteWakeup(&PCD_HandleStruct);
+	return true;
 }
 
 /**
@@ -633,8 +864,14 @@ void HAL_PCD_MspInit(PCD_HandleTypeDef * hpcd)
 		GPIO_InitStruct.Alternate = GPIO_AF10_OTG_FS;
 		HAL_GPIO_Init(GPIOA, &GPIO_InitStruct);
 		__HAL_RCC_USB_OTG_FS_CLK_ENABLE();
-		HAL_NVIC_SetPriority(OTG_FS_IRQn, 0, 0);
+		HAL_NVIC_SetPriority(OTG_FS_IRQn, IRQ_PRIO_USB, 0);
 		HAL_NVIC_EnableIRQ(OTG_FS_IRQn);
+
+		__HAL_USB_OTG_FS_WAKEUP_EXTI_CLEAR_FLAG();
+		__HAL_USB_OTG_FS_WAKEUP_EXTI_ENABLE_RISING_EDGE();
+		__HAL_USB_OTG_FS_WAKEUP_EXTI_ENABLE_IT();
+		HAL_NVIC_SetPriority(OTG_FS_WKUP_IRQn, IRQ_PRIO_USB, 0);
+		HAL_NVIC_EnableIRQ(OTG_FS_WKUP_IRQn);
 	}
 }
 
@@ -647,8 +884,7 @@ void USB_HIDInReportSubmit(unsigned channel, const uint8_t *report)
 		return;
 	memcpy(state->HIDReportIn[channel], report, sizeof(state->HIDReportIn[channel]));
 	bool send_pkt = false;
-	uint32_t primask_bit = __get_PRIMASK();
-	__disable_irq();
+	uint32_t basepri = IRQ_Lock(IRQ_PRIO_USB);
 	if (state->Config) {
 		if (state->ReportState[channel] == REPORT_BUSY)
 			state->ReportState[channel] = REPORT_PENDING;
@@ -658,12 +894,26 @@ void USB_HIDInReportSubmit(unsigned channel, const uint8_t *report)
 			send_pkt = true;
 		}
 	}
-	__set_PRIMASK(primask_bit);
+	IRQ_Unlock(basepri);
 	if (send_pkt) {
 		HAL_PCD_EP_Transmit(&PCD_HandleStruct, channel+1, state->HIDReportIn[channel], PCD_HandleStruct.IN_ep[channel+1].maxpacket);
 	}
 }
 
+/* True if the host has collected the last input report submitted on
+   channel, so that a new one will go out on the next poll */
+RAMFUNC bool USB_HIDInReportIdle(unsigned channel)
+{
+	return USB_StateStruct.ReportState[channel] == REPORT_IDLE;
+}
+
+/* Time in ms from reset until the host first collected an input
+   report, or 0 if it has not yet */
+uint32_t USB_GetFirstReportTick(void)
+{
+	return USB_StateStruct.FirstReportTick;
+}
+
 void USB_Setup_USB(void)
 {
 	PCD_HandleStruct.Instance = USB_OTG_FS;
@@ -681,11 +931,13 @@ void USB_Setup_USB(void)
 	PCD_HandleStruct.pData = &USB_StateStruct;
 	CHECK_HAL_RESULT(HAL_PCD_Init(&PCD_HandleStruct));
 	
-	/* configure EPs FIFOs */
+	/* configure EPs FIFOs, in words, out of 320.  The HID reports
+	   are small, so their FIFOs are the minimum of 16 */
 	HAL_PCDEx_SetRxFiFo(&PCD_HandleStruct, 0x80);
 	HAL_PCDEx_SetTxFiFo(&PCD_HandleStruct, 0, 0x40);
-	HAL_PCDEx_SetTxFiFo(&PCD_HandleStruct, 1, 0x40);
-	HAL_PCDEx_SetTxFiFo(&PCD_HandleStruct, 2, 0x40);
+	HAL_PCDEx_SetTxFiFo(&PCD_HandleStruct, 1, 0x10);
+	HAL_PCDEx_SetTxFiFo(&PCD_HandleStruct, 2, 0x10);
+	HAL_PCDEx_SetTxFiFo(&PCD_HandleStruct, 3, 0x40);
 
 	CHECK_HAL_RESULT(HAL_PCD_Start(&PCD_HandleStruct));
 }
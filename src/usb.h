@@ -1,3 +1,41 @@
 extern void USB_Setup_USB(void);
 extern void USB_HIDInReportSubmit(unsigned channel, const uint8_t *report);
-extern void USB_HIDOutReportCallback(const uint8_t *report);
+extern bool USB_HIDInReportIdle(unsigned channel);
+extern void USB_HIDOutReportCallback(unsigned channel, const uint8_t *report);
+extern uint32_t USB_GetFirstReportTick(void);
+extern bool USB_IsSuspended(void);
+extern bool USB_RemoteWakeup(void);
+
+/* High resolution dial steps per detent, when the host sets the
+   Resolution Multiplier feature on interface 1.  The knob is reported
+   as a Wheel: hosts only apply the multiplier to Wheel and AC Pan. */
+#define USB_HID_DIAL_RESOLUTION  8
+
+/* Output report on interface 1: band count, then up to 32 magnitudes */
+#define USB_HID_SPECTRUM_REPORT_SIZE  33
+
+/* Vendor OUT requests with a data stage carry up to USB_VENDOR_DATA_MAX
+   bytes followed by their CRC-32 (IEEE 802.3, as NVM_CRC32), little
+   endian; the request is stalled if it does not match */
+#define USB_VENDOR_DATA_MAX  1024
+
+#define USB_VENDOR_REQ_EFFECT_WRITE   0x01  /* wIndex: offset */
+#define USB_VENDOR_REQ_EFFECT_COMMIT  0x02
+#define USB_VENDOR_REQ_TELEMETRY      0x03  /* IN */
+#define USB_VENDOR_REQ_KEYMAP_WRITE   0x04  /* wIndex: offset */
+#define USB_VENDOR_REQ_KEYMAP_COMMIT  0x05  /* wValue: length, wIndex: layer */
+#define USB_VENDOR_REQ_MACRO_WRITE    0x06  /* wIndex: offset */
+#define USB_VENDOR_REQ_MACRO_COMMIT   0x07  /* wValue: length */
+#define USB_VENDOR_REQ_TAPHOLD        0x08  /* wValue: tapping term in ms, wIndex: policy flags */
+#define USB_VENDOR_REQ_CAPTURE        0x09  /* wValue: every nth pass or 0 for off, wIndex: column mask */
+#define USB_VENDOR_REQ_ANALOG_WRITE   0x0A  /* wIndex: offset */
+#define USB_VENDOR_REQ_ANALOG_COMMIT  0x0B  /* wValue: length, 0 for the plain threshold */
+#define USB_VENDOR_REQ_HEALTH         0x0C  /* IN, wIndex: row */
+#define USB_VENDOR_REQ_HEALTH_CLEAR   0x0D
+#define USB_VENDOR_REQ_ADC_FILTER     0x0E  /* wValue: conversions per column, wIndex: IIR filter shift */
+#define USB_VENDOR_REQ_DFU            0x0F  /* restart into the ROM bootloader */
+
+extern bool USB_VendorOutCallback(uint8_t request, uint16_t value, uint16_t index, const uint8_t *data, uint16_t len);
+/* Returns the data for an IN request, which must stay valid until the
+   transfer completes, or NULL to stall */
+extern const void *USB_VendorInCallback(uint8_t request, uint16_t value, uint16_t index, uint16_t *len);
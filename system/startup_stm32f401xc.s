@@ -79,6 +79,20 @@ defined in linker script */
 Reset_Handler:  
   ldr   sp, =_estack      /* set stack pointer */
 
+/* Copy the code which runs from SRAM */
+  ldr  r0, =_sramfunc
+  ldr  r1, =_eramfunc
+  ldr  r2, =_siramfunc
+  b  LoopCopyRamfunc
+
+CopyRamfunc:
+  ldr  r3, [r2], #4
+  str  r3, [r0], #4
+
+LoopCopyRamfunc:
+  cmp  r0, r1
+  bcc  CopyRamfunc
+
 /* Copy the data segment initializers from flash to SRAM */  
   movs  r1, #0
   b  LoopCopyDataInit
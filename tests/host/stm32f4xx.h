@@ -0,0 +1,20 @@
+/* Stand-in for the CMSIS device header in host builds of the hardware
+   independent modules (see tests/); only what they use */
+#define __NVIC_PRIO_BITS  4
+
+#define __CLZ(x)  ((uint8_t)__builtin_clz(x))
+
+static inline uint32_t __get_BASEPRI(void)
+{
+	return 0;
+}
+
+static inline void __set_BASEPRI(uint32_t basepri)
+{
+	(void)basepri;
+}
+
+static inline void __set_BASEPRI_MAX(uint32_t basepri)
+{
+	(void)basepri;
+}
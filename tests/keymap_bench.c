@@ -0,0 +1,142 @@
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "key.h"
+#include "led.h"
+#include "layout.h"
+#include "settings.h"
+#include "keymap.h"
+
+/*
+ * Host benchmark of the layer lookup in src/keymap.c, built and run by
+ * make test: the time KEYMAP_Press and KEYMAP_Release add to each key
+ * event on the scan-to-report path, with every layer populated and
+ * all of them active.  The layout, settings and macro player are
+ * stubbed out below, and tests/host/stm32f4xx.h stands in for the
+ * device header.  It fails only if the lookup resolves wrongly; the
+ * timing is for comparison between builds on the same machine.
+ */
+
+#define ROUNDS  100000
+
+const LAYOUT_KeyTypeDef LAYOUT_Keys[KEY_CODE_MAX+1];
+
+static uint8_t Layers[KEYMAP_LAYERS][KEYMAP_LAYER_MAX];
+static unsigned LayerLength[KEYMAP_LAYERS];
+
+static unsigned Layer(unsigned id)
+{
+	return id >= SETTINGS_ID_KEYMAP_EXT_0? id - SETTINGS_ID_KEYMAP_EXT_0 : id - SETTINGS_ID_KEYMAP_0;
+}
+
+static unsigned Offset(unsigned id)
+{
+	return id >= SETTINGS_ID_KEYMAP_EXT_0? KEYMAP_BANK_MAX : 0;
+}
+
+unsigned SETTINGS_GetLength(unsigned id)
+{
+	unsigned len, offs = Offset(id);
+
+	if (id < SETTINGS_ID_KEYMAP_0 || (id > SETTINGS_ID_KEYMAP_7 && id < SETTINGS_ID_KEYMAP_EXT_0) ||
+	    id > SETTINGS_ID_KEYMAP_EXT_7)
+		return 0;
+	len = LayerLength[Layer(id)];
+	if (len <= offs)
+		return 0;
+	return len - offs < KEYMAP_BANK_MAX? len - offs : KEYMAP_BANK_MAX;
+}
+
+bool SETTINGS_Get(unsigned id, void *value, unsigned len)
+{
+	if (len != SETTINGS_GetLength(id))
+		return false;
+	memcpy(value, Layers[Layer(id)] + Offset(id), len);
+	return true;
+}
+
+void SETTINGS_Set(unsigned id, const void *value, unsigned len)
+{
+}
+
+void MACRO_Play(unsigned n)
+{
+}
+
+/* Layer 0 has a toggle for every layer on key codes 0-7, which the
+   others leave transparent.  Above those, layer l maps every key
+   code, to usage l for a key code divisible by l + 1 and transparent
+   otherwise. */
+static void Populate(void)
+{
+	unsigned layer, kc;
+
+	for (layer = 0; layer < KEYMAP_LAYERS; layer++) {
+		uint8_t *e = Layers[layer];
+		for (kc = 0; kc <= KEY_CODE_MAX; kc++) {
+			uint16_t action = kc < KEYMAP_LAYERS || kc % (layer + 1)?
+				KEYMAP_ACTION_TRANS : KEYMAP_ACTION_USAGE(layer);
+			if (!layer)
+				action = kc < KEYMAP_LAYERS? KEYMAP_ACTION_TG(kc) : KEYMAP_ACTION_USAGE(0x04);
+			*e++ = kc;
+			*e++ = action;
+			*e++ = action >> 8;
+		}
+		LayerLength[layer] = e - Layers[layer];
+	}
+}
+
+/* What Keymap_Resolve should find for kc with every layer active */
+static uint16_t Expected(unsigned kc)
+{
+	int layer;
+
+	for (layer = KEYMAP_LAYERS - 1; layer > 0; layer--)
+		if (!(kc % (layer + 1)))
+			return KEYMAP_ACTION_USAGE(layer);
+	return kc < KEYMAP_LAYERS? KEYMAP_ACTION_TG(kc) : KEYMAP_ACTION_USAGE(0x04);
+}
+
+int main(void)
+{
+	struct timespec start, end;
+	unsigned round, kc, failures = 0;
+	volatile uint16_t sink;
+	double ns;
+
+	Populate();
+	KEYMAP_Load();
+	for (kc = 1; kc < KEYMAP_LAYERS; kc++) {
+		KEYMAP_Press(kc);
+		KEYMAP_Release(kc);
+	}
+	if (KEYMAP_GetLayers() != 0xff) {
+		printf("keymap: layers 0x%02x active, expected 0xff\n", KEYMAP_GetLayers());
+		return 1;
+	}
+	for (kc = KEYMAP_LAYERS; kc <= KEY_CODE_MAX; kc++) {
+		uint16_t action = KEYMAP_Press(kc);
+		if (action != Expected(kc) || KEYMAP_Release(kc) != action) {
+			printf("keymap: key %02x resolved to %04x, expected %04x\n", kc, action, Expected(kc));
+			failures++;
+		}
+	}
+	if (failures)
+		return 1;
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for (round = 0; round < ROUNDS; round++)
+		for (kc = KEYMAP_LAYERS; kc <= KEY_CODE_MAX; kc++) {
+			sink = KEYMAP_Press(kc);
+			sink = KEYMAP_Release(kc);
+		}
+	clock_gettime(CLOCK_MONOTONIC, &end);
+	(void)sink;
+	ns = (end.tv_sec - start.tv_sec) * 1e9 + (end.tv_nsec - start.tv_nsec);
+	printf("keymap: %.1f ns per press and release, %d layers active\n",
+	       ns / ROUNDS / (KEY_CODE_MAX + 1 - KEYMAP_LAYERS), KEYMAP_LAYERS);
+	return 0;
+}
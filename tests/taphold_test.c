@@ -0,0 +1,203 @@
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "settings.h"
+#include "taphold.h"
+
+/*
+ * Host test of src/taphold.c, built and run by make test.  taphold.c
+ * only depends on the events it is fed and on settings.c, which is
+ * stubbed out below.
+ */
+
+#define KEY_A  0x21  /* the tap-hold key */
+#define KEY_B  0x22
+#define KEY_C  0x23
+#define DOWN(kc)  ((kc) | TAPHOLD_EVENT_DOWN)
+#define UP(kc)    (kc)
+#define TERM  TAPHOLD_DEFAULT_TERM_MS
+
+static unsigned Failures;
+
+#define CHECK(cond) do { \
+	if (!(cond)) { \
+		printf("%s:%d: %s: %s\n", __FILE__, __LINE__, __func__, #cond); \
+		Failures++; \
+	} \
+} while (0)
+
+bool SETTINGS_Get(unsigned id, void *value, unsigned len)
+{
+	return false;
+}
+
+void SETTINGS_Set(unsigned id, const void *value, unsigned len)
+{
+}
+
+static uint16_t Events[TAPHOLD_BUFFER];
+static uint32_t Ticks[TAPHOLD_BUFFER];
+
+static unsigned Take(void)
+{
+	return TAPHOLD_TakeEvents(Events, Ticks);
+}
+
+static void Setup(unsigned flags)
+{
+	CHECK(TAPHOLD_Configure(TERM, flags));
+	CHECK(!TAPHOLD_Pending());
+}
+
+static void TestTap(void)
+{
+	Setup(0);
+	TAPHOLD_Start(KEY_A, 1000);
+	CHECK(TAPHOLD_Pending());
+	CHECK(TAPHOLD_GetKey() == KEY_A);
+	CHECK(TAPHOLD_Timeout(1000 + TERM - 1) == TAPHOLD_UNDECIDED);
+	CHECK(TAPHOLD_Event(KEY_A, false, 1000 + TERM - 1) == TAPHOLD_TAP);
+	CHECK(Take() == 0);
+	CHECK(!TAPHOLD_Pending());
+}
+
+static void TestTimeout(void)
+{
+	Setup(0);
+	TAPHOLD_Start(KEY_A, 1000);
+	CHECK(TAPHOLD_Timeout(1000 + TERM - 1) == TAPHOLD_UNDECIDED);
+	CHECK(TAPHOLD_Timeout(1000 + TERM) == TAPHOLD_HOLD);
+	CHECK(Take() == 0);
+	CHECK(TAPHOLD_Timeout(2000) == TAPHOLD_UNDECIDED);
+}
+
+/* Wrapping of the millisecond tick must not decide anything early */
+static void TestTickWrap(void)
+{
+	Setup(0);
+	TAPHOLD_Start(KEY_A, 0xfffffff0u);
+	CHECK(TAPHOLD_Timeout(0x10) == TAPHOLD_UNDECIDED);
+	CHECK(TAPHOLD_Timeout(TERM - 0x10) == TAPHOLD_HOLD);
+	Take();
+}
+
+/* Another key pressed and the tap-hold key released first: a tap, with
+   the other press replayed at the tick it was seen */
+static void TestRoll(void)
+{
+	Setup(0);
+	TAPHOLD_Start(KEY_A, 1000);
+	CHECK(TAPHOLD_Event(KEY_B, true, 1050) == TAPHOLD_UNDECIDED);
+	CHECK(TAPHOLD_Event(KEY_A, false, 1100) == TAPHOLD_TAP);
+	CHECK(Take() == 1);
+	CHECK(Events[0] == DOWN(KEY_B));
+	CHECK(Ticks[0] == 1050);
+}
+
+/* Without a policy a key tapped inside the term does not decide */
+static void TestNestedTapNoPolicy(void)
+{
+	Setup(0);
+	TAPHOLD_Start(KEY_A, 1000);
+	CHECK(TAPHOLD_Event(KEY_B, true, 1020) == TAPHOLD_UNDECIDED);
+	CHECK(TAPHOLD_Event(KEY_B, false, 1040) == TAPHOLD_UNDECIDED);
+	CHECK(TAPHOLD_Timeout(1000 + TERM) == TAPHOLD_HOLD);
+	CHECK(Take() == 2);
+	CHECK(Events[0] == DOWN(KEY_B) && Ticks[0] == 1020);
+	CHECK(Events[1] == UP(KEY_B) && Ticks[1] == 1040);
+}
+
+static void TestPermissiveHold(void)
+{
+	Setup(TAPHOLD_PERMISSIVE_HOLD);
+	TAPHOLD_Start(KEY_A, 1000);
+	CHECK(TAPHOLD_Event(KEY_B, true, 1020) == TAPHOLD_UNDECIDED);
+	CHECK(TAPHOLD_Event(KEY_B, false, 1040) == TAPHOLD_HOLD);
+	CHECK(Take() == 2);
+	CHECK(Events[0] == DOWN(KEY_B) && Events[1] == UP(KEY_B));
+
+	/* A key already down when the tap-hold key was pressed */
+	TAPHOLD_Start(KEY_A, 2000);
+	CHECK(TAPHOLD_Event(KEY_C, false, 2020) == TAPHOLD_UNDECIDED);
+	CHECK(TAPHOLD_Event(KEY_A, false, 2040) == TAPHOLD_TAP);
+	CHECK(Take() == 1);
+	CHECK(Events[0] == UP(KEY_C) && Ticks[0] == 2020);
+}
+
+static void TestHoldOnOtherKey(void)
+{
+	Setup(TAPHOLD_HOLD_ON_OTHER_KEY);
+	TAPHOLD_Start(KEY_A, 1000);
+	CHECK(TAPHOLD_Event(KEY_C, false, 1010) == TAPHOLD_UNDECIDED);
+	CHECK(TAPHOLD_Event(KEY_B, true, 1020) == TAPHOLD_HOLD);
+	CHECK(Take() == 2);
+	CHECK(Events[1] == DOWN(KEY_B) && Ticks[1] == 1020);
+}
+
+/* Released after the term but before a scan pass timed it out: a hold,
+   and the release is replayed after the hold */
+static void TestLateRelease(void)
+{
+	Setup(0);
+	TAPHOLD_Start(KEY_A, 1000);
+	CHECK(TAPHOLD_Event(KEY_A, false, 1000 + TERM) == TAPHOLD_HOLD);
+	CHECK(Take() == 1);
+	CHECK(Events[0] == UP(KEY_A) && Ticks[0] == 1000 + TERM);
+}
+
+/* An event past the term decides a hold even if it is another key's */
+static void TestLateOtherKey(void)
+{
+	Setup(0);
+	TAPHOLD_Start(KEY_A, 1000);
+	CHECK(TAPHOLD_Event(KEY_B, true, 1000 + TERM) == TAPHOLD_HOLD);
+	CHECK(Take() == 1);
+}
+
+static void TestBufferFull(void)
+{
+	unsigned i;
+
+	Setup(0);
+	TAPHOLD_Start(KEY_A, 1000);
+	for (i = 0; i < TAPHOLD_BUFFER - 1; i++)
+		CHECK(TAPHOLD_Event(KEY_B, !(i & 1), 1001 + i) == TAPHOLD_UNDECIDED);
+	CHECK(TAPHOLD_Event(KEY_B, false, 1001 + i) == TAPHOLD_HOLD);
+	CHECK(Take() == TAPHOLD_BUFFER);
+	for (i = 0; i < TAPHOLD_BUFFER; i++)
+		CHECK(Ticks[i] == 1001 + i);
+}
+
+static void TestConfigure(void)
+{
+	CHECK(!TAPHOLD_Configure(0, 0));
+	CHECK(!TAPHOLD_Configure(0x10000, 0));
+	CHECK(!TAPHOLD_Configure(TERM, 0x04));
+	CHECK(TAPHOLD_Configure(50, 0));
+	TAPHOLD_Start(KEY_A, 1000);
+	CHECK(TAPHOLD_Timeout(1050) == TAPHOLD_HOLD);
+	Take();
+}
+
+int main(void)
+{
+	TAPHOLD_Load();
+	TestTap();
+	TestTimeout();
+	TestTickWrap();
+	TestRoll();
+	TestNestedTapNoPolicy();
+	TestPermissiveHold();
+	TestHoldOnOtherKey();
+	TestLateRelease();
+	TestLateOtherKey();
+	TestBufferFull();
+	TestConfigure();
+	if (Failures) {
+		printf("taphold: %u checks failed\n", Failures);
+		return 1;
+	}
+	printf("taphold: all passed\n");
+	return 0;
+}
@@ -0,0 +1,153 @@
+#!/usr/bin/env python3
+"""Configure rapid trigger, actuation depths and sensor filtering (src/analog.c, src/adc.c)
+
+With rapid trigger a key goes down once it has been pushed SENSITIVITY
+ADC counts further than where it last turned, and is past its
+actuation depth; it goes back up once it has risen SENSITIVITY counts
+from its deepest point.  Depths are in units of 8 counts past the
+reference the plain threshold compares against, 0 being that
+threshold.  A configuration file has one setting per line, '#' starts
+a comment:
+
+    sensitivity 40          # counts, 1-255
+    actuation 4             # every key
+    actuation 12 21 22 23   # these key codes, as in src/layout.txt
+
+  analog.py upload FILE           store the configuration on the keyboard
+  analog.py off                   go back to the plain threshold
+  analog.py replay FILE CAPTURE [-k K]
+                                  run rapid trigger on a capture made
+                                  with capture.py, printing key changes;
+                                  -k filters it first, as the keyboard
+                                  does with that shift
+  analog.py filter [-n N] [-k K]  convert every column N times (1, 2, 4
+                                  or 8) and average, then filter with a
+                                  gain of 1/2^K (0, no filter, to 3)
+
+Oversampling costs scan rate, and filtering adds latency, about 2^K
+passes; compare the scan rate from telemetry.py and the bounces from
+health.py before and after.
+"""
+
+import argparse
+import sys
+
+import capture
+from vendor import write
+
+VID, PID = 0x24f0, 0x2020
+REQ_ANALOG_WRITE = 0x0a
+REQ_ANALOG_COMMIT = 0x0b
+REQ_ADC_FILTER = 0x0e
+FLAG_RAPID_TRIGGER = 0x01
+DEPTH_UNIT = 8
+KEY_CODE_MAX = 0x8d
+
+
+def parse(text):
+    sensitivity = None
+    depth = [0] * (KEY_CODE_MAX + 1)
+    for lineno, line in enumerate(text.splitlines(), 1):
+        words = line.split('#', 1)[0].split()
+        if not words:
+            continue
+        try:
+            if words[0] == 'sensitivity' and len(words) == 2:
+                sensitivity = int(words[1], 0)
+                if not 1 <= sensitivity <= 255:
+                    raise ValueError('sensitivity must be 1-255')
+            elif words[0] == 'actuation' and len(words) >= 2:
+                d = int(words[1], 0)
+                if not 0 <= d <= 255:
+                    raise ValueError('actuation depth must be 0-255')
+                kcs = ([int(w, 16) for w in words[2:]] or
+                       [kc for kc in range(KEY_CODE_MAX + 1) if (kc & 0xf) < capture.COLUMNS])
+                for kc in kcs:
+                    if kc > KEY_CODE_MAX or (kc & 0xf) >= capture.COLUMNS:
+                        raise ValueError('no key code %02x' % kc)
+                    depth[kc] = d
+            else:
+                raise ValueError('cannot parse %r' % line.strip())
+        except ValueError as e:
+            raise SyntaxError('line %d: %s' % (lineno, e))
+    if sensitivity is None:
+        raise SyntaxError('no sensitivity given')
+    return sensitivity, depth
+
+
+def encode(sensitivity, depth):
+    return bytes([FLAG_RAPID_TRIGGER, sensitivity] + depth)
+
+
+def open_device():
+    import usb.core
+    dev = usb.core.find(idVendor=VID, idProduct=PID)
+    if dev is None:
+        sys.exit('keyboard not found')
+    return dev
+
+
+def upload(config):
+    dev = open_device()
+    write(dev, REQ_ANALOG_WRITE, config)
+    dev.ctrl_transfer(0x40, REQ_ANALOG_COMMIT, len(config), 0, b'')
+
+
+def replay(sensitivity, depth, path, shift):
+    """ANALOG_ColumnMask in src/analog.c, over a capture file"""
+    actuation = [[depth[row << 4 | col] * DEPTH_UNIT + 1 for row in range(9)]
+                 for col in range(capture.COLUMNS)]
+    extreme = [[0] * 9 for _ in range(capture.COLUMNS)]
+    last = [0] * capture.COLUMNS
+    filters = [None] * capture.COLUMNS
+    for rec in capture.read(path):
+        pass_, _, column, _ = rec[:4]
+        sample = rec[4:]
+        if shift:
+            filters[column], sample = capture.iir(filters[column], sample, shift)
+        mask = last[column]
+        for row in range(9):
+            travel = sample[0] - sample[2 + row]
+            down = mask >> row & 1
+            e = extreme[column][row]
+            moved = e - travel if down else travel - e
+            flip = moved >= sensitivity and (down or travel >= actuation[column][row])
+            if moved < 0 or flip:
+                extreme[column][row] = travel
+            if flip:
+                mask ^= 1 << row
+                print('pass %8d  key %02x %s  travel %d' % (
+                    pass_, row << 4 | column, 'up  ' if down else 'down', travel))
+        last[column] = mask
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split('\n')[0])
+    ap.add_argument('command', choices=('upload', 'off', 'replay', 'filter'))
+    ap.add_argument('file', nargs='?')
+    ap.add_argument('capture', nargs='?')
+    ap.add_argument('-n', '--oversample', type=int, default=1, choices=(1, 2, 4, 8),
+                    help='conversions per column')
+    ap.add_argument('-k', '--shift', type=int, default=0, choices=range(4),
+                    help='IIR filter gain 1/2^SHIFT, 0 for none')
+    args = ap.parse_args()
+
+    if args.command == 'filter':
+        open_device().ctrl_transfer(0x40, REQ_ADC_FILTER, args.oversample, args.shift, b'')
+        return
+    if args.command == 'off':
+        upload(b'')
+        return
+    if not args.file:
+        ap.error('no configuration given')
+    sensitivity, depth = parse(open(args.file).read())
+    if args.command == 'upload':
+        upload(encode(sensitivity, depth))
+    elif not args.capture:
+        ap.error('no capture given')
+    else:
+        replay(sensitivity, depth, args.capture, args.shift)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,164 @@
+#!/usr/bin/env python3
+"""Record raw key sensor samples and replay them (src/capture.c)
+
+The keyboard streams the 12 conversions of each matrix column on a
+vendor interface, two columns per 1 ms frame.  A full rate scan makes
+far more than that, so pick every how many passes to record, and
+which columns; the rest is dropped, and counted.
+
+A capture file is the header b'HDCAP', a version byte (1) and the
+record size (32, 16 bits little endian), followed by the records as
+sent by the keyboard:
+
+    uint32 pass, uint16 mask, uint8 column, uint8 dropped,
+    int16 sample[12]
+
+sample[0] is the reference the key channels, sample[2] to sample[10],
+are compared against; mask is what the firmware made of it, bit n for
+sample[n+2].  The samples are averaged over the oversampled conversions
+but recorded before the IIR filter (analog.py filter): pass the filter's
+shift to replay with -k to run it as the firmware does.  That needs
+every pass of a column, so record with -e 1 and nothing dropped.
+
+  capture.py record FILE [-e N] [-c COLS] [-s SEC]
+                                  record every Nth pass of the columns
+  capture.py replay FILE [-o OFFSET] [-k SHIFT]
+                                  run the key detection again, printing
+                                  key changes and any differences from
+                                  the firmware's
+"""
+
+import argparse
+import struct
+import sys
+import time
+
+VID, PID = 0x24f0, 0x2020
+REQ_CAPTURE = 0x09
+INTERFACE = 2
+ENDPOINT = 0x83
+MAGIC = b'HDCAP'
+VERSION = 1
+RECORD = struct.Struct('<IHBB12h')
+COLUMNS = 14
+
+
+def record(path, every, columns, seconds):
+    import usb.core
+    import usb.util
+    dev = usb.core.find(idVendor=VID, idProduct=PID)
+    if dev is None:
+        sys.exit('keyboard not found')
+    usb.util.claim_interface(dev, INTERFACE)
+    dev.ctrl_transfer(0x40, REQ_CAPTURE, every, columns, b'')
+    records = dropped = 0
+    try:
+        with open(path, 'wb') as f:
+            f.write(MAGIC + struct.pack('<BH', VERSION, RECORD.size))
+            end = time.monotonic() + seconds
+            while time.monotonic() < end:
+                try:
+                    data = bytes(dev.read(ENDPOINT, 64, timeout=100))
+                except usb.core.USBTimeoutError:
+                    continue
+                f.write(data)
+                for offs in range(0, len(data), RECORD.size):
+                    records += 1
+                    dropped += RECORD.unpack_from(data, offs)[3]
+    finally:
+        dev.ctrl_transfer(0x40, REQ_CAPTURE, 0, 0, b'')
+        usb.util.release_interface(dev, INTERFACE)
+    print('%d records, at least %d dropped' % (records, dropped))
+
+
+def read(path):
+    with open(path, 'rb') as f:
+        data = f.read()
+    if data[:len(MAGIC)] != MAGIC:
+        sys.exit('%s: not a capture file' % path)
+    version, size = struct.unpack_from('<BH', data, len(MAGIC))
+    if version != VERSION or size != RECORD.size:
+        sys.exit('%s: unsupported version %d' % (path, version))
+    offs = len(MAGIC) + 3
+    for offs in range(offs, len(data) - size + 1, size):
+        yield RECORD.unpack_from(data, offs)
+
+
+def key_mask(sample, offset):
+    """The firmware's key detection, HAL_ADC_ConvCpltCallback in src/adc.c"""
+    mask = 0
+    for i in range(9):
+        if sample[2 + i] < sample[0] - offset:
+            mask |= 1 << i
+    return mask
+
+
+def iir(state, sample, shift):
+    """The firmware's IIR filter, ADC_Filter in src/adc.c"""
+    half = 1 << shift >> 1
+    if state is None:
+        state = [x << shift for x in sample]
+    for i, x in enumerate(sample):
+        state[i] += x - ((state[i] + half) >> shift)
+    return state, [(s + half) >> shift for s in state]
+
+
+def replay(path, offset, shift):
+    last = [0] * COLUMNS
+    filters = [None] * COLUMNS
+    records = dropped = differ = 0
+    for rec in read(path):
+        pass_, fw_mask, column, drops = rec[:4]
+        sample = rec[4:]
+        records += 1
+        dropped += drops
+        if shift:
+            filters[column], sample = iir(filters[column], sample, shift)
+        mask = key_mask(sample, offset)
+        if offset == 0 and mask != fw_mask:
+            differ += 1
+        changed = mask ^ last[column]
+        for row in range(9):
+            if changed >> row & 1:
+                kc = row << 4 | column
+                print('pass %8d  key %02x %s  sample %d reference %d' % (
+                    pass_, kc, 'down' if mask >> row & 1 else 'up  ',
+                    sample[2 + row], sample[0]))
+        last[column] = mask
+    print('%d records, %d dropped' % (records, dropped), file=sys.stderr)
+    if differ:
+        print('%d records differ from the firmware' % differ, file=sys.stderr)
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split('\n')[0])
+    ap.add_argument('command', choices=('record', 'replay'))
+    ap.add_argument('file')
+    ap.add_argument('-e', '--every', type=int, default=1, help='record every EVERY passes')
+    ap.add_argument('-c', '--columns', default='0-13', help='columns, e.g. 0-3,7')
+    ap.add_argument('-s', '--seconds', type=float, default=10, help='how long to record')
+    ap.add_argument('-o', '--offset', type=int, default=0,
+                    help='extra margin below the reference for a key to count as down')
+    ap.add_argument('-k', '--filter-shift', type=int, default=0,
+                    help='IIR filter shift the keyboard was set to, 0 for none')
+    args = ap.parse_args()
+
+    if args.command == 'record':
+        columns = 0
+        for part in args.columns.split(','):
+            lo, _, hi = part.partition('-')
+            for c in range(int(lo), int(hi or lo) + 1):
+                if not 0 <= c < COLUMNS:
+                    ap.error('no column %d' % c)
+                columns |= 1 << c
+        if not 0 < args.every <= 0xffff:
+            ap.error('every must be 1-65535')
+        record(args.file, args.every, columns, args.seconds)
+    else:
+        if not 0 <= args.filter_shift <= 3:
+            ap.error('filter shift must be 0-3')
+        replay(args.file, args.offset, args.filter_shift)
+
+
+if __name__ == '__main__':
+    main()
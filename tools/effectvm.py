@@ -0,0 +1,209 @@
+#!/usr/bin/env python3
+"""Assembler, emulator and uploader for effect programs (src/effect_vm.c)
+
+Programs are written as whitespace separated words, executed left to
+right; numbers are pushed, everything else is an opcode.  '#' starts a
+comment.  The value left on top of the stack is the colour, 0xRRGGBB.
+Example, a rainbow scrolling to the right:
+
+    x 3 shl  t 2 shr  sub  wave  hue
+
+  effectvm.py asm prog.txt            print the bytecode as hex
+  effectvm.py run prog.txt [-t MS] [-k KC,...]
+                                      print the colour of every LED
+  effectvm.py upload prog.txt         store the program on the keyboard
+  effectvm.py upload --clear          go back to the built-in effect
+"""
+
+import argparse
+import math
+import os
+import re
+import struct
+import sys
+
+import layoutgen
+from vendor import write
+
+VID, PID = 0x24f0, 0x2020
+REQ_EFFECT_WRITE = 0x01
+REQ_EFFECT_COMMIT = 0x02
+CODE_MAX = 256
+STACK_MAX = 16
+FRAME_BUDGET = 16384
+NUM_LEDS = 0x90
+
+# name: (opcode, inputs, outputs)
+OPS = {
+    'x': (0x08, 0, 1), 'y': (0x09, 0, 1), 't': (0x0a, 0, 1), 'key': (0x0b, 0, 1),
+    'dup': (0x10, 1, 2), 'drop': (0x11, 1, 0), 'swap': (0x12, 2, 2), 'over': (0x13, 2, 3),
+    'add': (0x20, 2, 1), 'sub': (0x21, 2, 1), 'mul': (0x22, 2, 1), 'div': (0x23, 2, 1),
+    'mod': (0x24, 2, 1), 'and': (0x25, 2, 1), 'or': (0x26, 2, 1), 'xor': (0x27, 2, 1),
+    'shl': (0x28, 2, 1), 'shr': (0x29, 2, 1), 'min': (0x2a, 2, 1), 'max': (0x2b, 2, 1),
+    'lt': (0x2c, 2, 1), 'eq': (0x2d, 2, 1), 'neg': (0x30, 1, 1), 'not': (0x31, 1, 1),
+    'sel': (0x38, 3, 1), 'wave': (0x40, 1, 1), 'hue': (0x41, 1, 1), 'rgb': (0x42, 3, 1),
+}
+BY_CODE = {v[0]: k for k, v in OPS.items()}
+SRCDIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'src')
+
+
+def s32(v):
+    v &= 0xffffffff
+    return v - (1 << 32) if v & 0x80000000 else v
+
+
+def tdiv(a, b):
+    q = abs(a) // abs(b)
+    return q if (a < 0) == (b < 0) else -q
+
+
+def assemble(text):
+    code = bytearray()
+    depth = insns = 0
+    for lineno, line in enumerate(text.splitlines(), 1):
+        for word in line.split('#', 1)[0].split():
+            w = word.lower()
+            if re.fullmatch(r'-?(0x[0-9a-f]+|\d+)', w):
+                v = s32(int(w, 0))
+                if 0 <= v <= 0xff:
+                    code += bytes([0x01, v])
+                elif -0x8000 <= v <= 0x7fff:
+                    code += bytes([0x02]) + struct.pack('<h', v)
+                else:
+                    code += bytes([0x03]) + struct.pack('<i', v)
+                ins, outs = 0, 1
+            elif w in OPS:
+                op, ins, outs = OPS[w]
+                code.append(op)
+            else:
+                raise SyntaxError('line %d: unknown word %r' % (lineno, word))
+            if depth < ins:
+                raise SyntaxError('line %d: stack underflow at %r' % (lineno, word))
+            depth += outs - ins
+            if depth > STACK_MAX:
+                raise SyntaxError('line %d: stack overflow at %r' % (lineno, word))
+            insns += 1
+    if code and depth < 1:
+        raise SyntaxError('program leaves no colour on the stack')
+    if len(code) > CODE_MAX:
+        raise SyntaxError('program is %d bytes, maximum is %d' % (len(code), CODE_MAX))
+    if insns * NUM_LEDS > FRAME_BUDGET:
+        # The firmware checks this after constant folding, so this
+        # is conservative
+        print('warning: %d instructions per LED exceeds the frame budget of %d'
+              % (insns, FRAME_BUDGET // NUM_LEDS), file=sys.stderr)
+    return bytes(code)
+
+
+def wave(p):
+    return round(512 - 512 * math.cos(2 * math.pi * (p & 1023) / 1024))
+
+
+def hue_to_rgb(h):
+    h = (h & 0xffffffff) % (6 * 255)
+    f = h % 255
+    r, g, b = [(255, f, 0), (255 - f, 255, 0), (0, 255, f),
+               (0, 255 - f, 255), (f, 0, 255), (255, 0, 255 - f)][h // 255]
+    return (r << 16) | (g << 8) | b
+
+
+def execute(code, x, y, t, key):
+    st = []
+    pc = 0
+    clamp = lambda v: min(max(v, 0), 255)
+    while pc < len(code):
+        op = code[pc]
+        pc += 1
+        if op == 0x01:
+            st.append(code[pc]); pc += 1
+        elif op == 0x02:
+            st.append(struct.unpack_from('<h', code, pc)[0]); pc += 2
+        elif op == 0x03:
+            st.append(struct.unpack_from('<i', code, pc)[0]); pc += 4
+        else:
+            name = BY_CODE[op]
+            _, ins, _ = OPS[name]
+            args = [st.pop() for _ in range(ins)][::-1]
+            if name in ('x', 'y', 't', 'key'):
+                st.append({'x': x, 'y': y, 't': s32(t), 'key': key}[name])
+            elif name == 'dup': st += [args[0]] * 2
+            elif name == 'drop': pass
+            elif name == 'swap': st += args[::-1]
+            elif name == 'over': st += args + [args[0]]
+            else:
+                a = args[0]
+                b = args[1] if ins > 1 else None
+                if name == 'add': r = a + b
+                elif name == 'sub': r = a - b
+                elif name == 'mul': r = a * b
+                elif name == 'div': r = 0 if b == 0 else tdiv(a, b)
+                elif name == 'mod': r = 0 if b in (0, -1) else a - b * tdiv(a, b)
+                elif name == 'and': r = a & b
+                elif name == 'or': r = a | b
+                elif name == 'xor': r = a ^ b
+                elif name == 'shl': r = a << (b & 31)
+                elif name == 'shr': r = a >> (b & 31)
+                elif name == 'min': r = min(a, b)
+                elif name == 'max': r = max(a, b)
+                elif name == 'lt': r = int(a < b)
+                elif name == 'eq': r = int(a == b)
+                elif name == 'neg': r = -a
+                elif name == 'not': r = int(not a)
+                elif name == 'sel': r = args[1] if a else args[2]
+                elif name == 'wave': r = wave(a)
+                elif name == 'hue': r = hue_to_rgb(a)
+                elif name == 'rgb': r = (clamp(a) << 16) | (clamp(b) << 8) | clamp(args[2])
+                st.append(s32(r))
+    return st[-1] & 0xffffff
+
+
+def led_positions():
+    """LED positions, and the key of each LED, from src/layout.txt"""
+    leds, keys = layoutgen.parse(open(os.path.join(SRCDIR, 'layout.txt')).read())
+    ledkey = {}
+    for kc, (_, ids, _) in sorted(keys.items()):
+        for id in ids:
+            ledkey[id] = kc
+    return [leds[id][0] for id in sorted(leds)], [leds[id][1] for id in sorted(leds)], ledkey
+
+
+def upload(code):
+    import usb.core
+    dev = usb.core.find(idVendor=VID, idProduct=PID)
+    if dev is None:
+        sys.exit('keyboard not found')
+    write(dev, REQ_EFFECT_WRITE, code)
+    dev.ctrl_transfer(0x40, REQ_EFFECT_COMMIT, len(code), 0, b'')
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split('\n')[0])
+    ap.add_argument('command', choices=('asm', 'run', 'upload'))
+    ap.add_argument('file', nargs='?')
+    ap.add_argument('-t', '--time', type=int, default=0, help='time in ms')
+    ap.add_argument('-k', '--keys', default='', help='key codes held down, e.g. 0x51,0x73')
+    ap.add_argument('--clear', action='store_true', help='upload an empty program')
+    args = ap.parse_args()
+
+    if args.clear:
+        code = b''
+    elif args.file:
+        code = assemble(open(args.file).read())
+    else:
+        ap.error('no program given')
+
+    if args.command == 'asm':
+        print(code.hex(' '))
+    elif args.command == 'run':
+        xs, ys, ledkey = led_positions()
+        held = {int(k, 0) for k in args.keys.split(',') if k}
+        for led in range(NUM_LEDS):
+            key = int(ledkey.get(led) in held)
+            print('%02x x=%3d y=%3d %06x' % (led, xs[led], ys[led],
+                                             execute(code, xs[led], ys[led], args.time, key)))
+    else:
+        upload(code)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,73 @@
+#!/usr/bin/env python3
+"""Print per-key switch health statistics (src/health.c)
+
+For every key that has been pressed or looks marginal: presses,
+bounces (edges within 5 ms of the previous one), the lowest and
+highest margin seen, reference minus sample so positive when down,
+and the share of passes spent within +-32 counts of the threshold.
+Keys with bounces or a small margin on either side are marked '!'.
+
+  health.py               print the statistics
+  health.py -a            also print keys that look fine
+  health.py --clear       start counting again
+"""
+
+import argparse
+import os
+import struct
+
+import layoutgen
+
+VID, PID = 0x24f0, 0x2020
+REQ_HEALTH = 0x0c
+REQ_HEALTH_CLEAR = 0x0d
+ROWS, COLUMNS = 9, 14
+KEY = struct.Struct('<IHhhHI')
+WARN_MARGIN = 64
+SRCDIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'src')
+
+
+def read(dev):
+    keys = {}
+    passes = 0
+    for row in range(ROWS):
+        data = bytes(dev.ctrl_transfer(0xc0, REQ_HEALTH, 0, row, 4 + COLUMNS * KEY.size))
+        passes = struct.unpack_from('<I', data)[0]
+        for col in range(COLUMNS):
+            presses, bounces, lo, hi, _, band = KEY.unpack_from(data, 4 + col * KEY.size)
+            keys[row << 4 | col] = (presses, bounces, lo, hi, band)
+    return passes, keys
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split('\n')[0])
+    ap.add_argument('-a', '--all', action='store_true', help='print every key')
+    ap.add_argument('--clear', action='store_true', help='clear the statistics')
+    args = ap.parse_args()
+
+    import usb.core
+    dev = usb.core.find(idVendor=VID, idProduct=PID)
+    if dev is None:
+        raise SystemExit('keyboard not found')
+    if args.clear:
+        dev.ctrl_transfer(0x40, REQ_HEALTH_CLEAR, 0, 0, b'')
+        return
+
+    _, layout = layoutgen.parse(open(os.path.join(SRCDIR, 'layout.txt')).read())
+    passes, keys = read(dev)
+    print('%d passes' % passes)
+    print('key  presses bounces  margin min   max  band')
+    for kc, (presses, bounces, lo, hi, band) in sorted(keys.items()):
+        if kc not in layout or lo > hi:
+            continue  # no switch there, or not scanned yet
+        # A healthy key is well clear of the threshold both released
+        # and, once pressed, fully down
+        warn = bounces or -lo < WARN_MARGIN or (presses and hi < WARN_MARGIN)
+        if not (args.all or presses or warn):
+            continue
+        print('%02x %9d %7d %11d %5d %4.1f%% %s' % (
+            kc, presses, bounces, lo, hi, 100 * band / max(passes, 1), '!' if warn else ''))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,91 @@
+#!/usr/bin/env python3
+"""Patch the size and CRC of the firmware into its image header
+
+SystemInit (src/system_stm32f4xx.c) checks everything from FLASH
+(0x08010000, see system/STM32F401XB_FLASH.ld) against the header after
+the vector table before calling into it, and enters the ROM bootloader
+if they disagree.  Run on the .bin made by objcopy, which starts at
+0x08000000; the .elf and .hex keep a length of 0, which skips the check.
+
+  imagecrc.py darkness.bin            patch the header in place
+  imagecrc.py --check darkness.bin    only verify it
+"""
+
+import argparse
+import struct
+import sys
+
+MAGIC = struct.pack('<I', 0x4d494448)
+HEADER = struct.Struct('<III')
+BASE = 0x10000          # FLASH, from the start of the image
+LOW_SIZE = 0x8000       # FLASH_LO, where the header is
+SIZE_MAX = 0x10000
+
+
+def _table():
+    table = []
+    for i in range(256):
+        c = i << 24
+        for _ in range(8):
+            c = (c << 1) ^ 0x04c11db7 if c & 0x80000000 else c << 1
+        table.append(c & 0xffffffff)
+    return table
+
+
+TABLE = _table()
+
+
+def crc32_mpeg2(data):
+    """The STM32 CRC unit fed data as little endian words"""
+    crc = 0xffffffff
+    for i in range(0, len(data), 4):
+        for b in data[i:i + 4][::-1]:
+            crc = ((crc << 8) & 0xffffffff) ^ TABLE[(crc >> 24) ^ b]
+    return crc
+
+
+def find_header(image):
+    offs = image.find(MAGIC, 0, LOW_SIZE)
+    while offs >= 0 and offs % 4:
+        offs = image.find(MAGIC, offs + 1, LOW_SIZE)
+    if offs < 0:
+        raise SystemExit('no image header in the first %dK' % (LOW_SIZE // 1024))
+    return offs
+
+
+def patch(image):
+    """Pad image to whole words and fill in its header; returns the
+    length and CRC of the part in FLASH"""
+    image += b'\xff' * (-len(image) % 4)
+    code = image[BASE:]
+    if len(code) > SIZE_MAX:
+        raise SystemExit('image is %d bytes past 0x%x, maximum is %d' % (len(code), BASE, SIZE_MAX))
+    crc = crc32_mpeg2(code) if code else 0
+    HEADER.pack_into(image, find_header(image), struct.unpack('<I', MAGIC)[0], len(code), crc)
+    return len(code), crc
+
+
+def check(image):
+    """True if the header of image matches its contents"""
+    _, length, crc = HEADER.unpack_from(image, find_header(image))
+    code = bytes(image[BASE:BASE + length])
+    return length > 0 and len(code) == length and crc32_mpeg2(code) == crc
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split('\n')[0])
+    ap.add_argument('bin')
+    ap.add_argument('--check', action='store_true', help='verify without patching')
+    args = ap.parse_args()
+
+    image = bytearray(open(args.bin, 'rb').read())
+    if args.check:
+        if not check(image):
+            sys.exit('%s: image header does not match' % args.bin)
+        return
+    patch(image)
+    open(args.bin, 'wb').write(image)
+
+
+if __name__ == '__main__':
+    main()
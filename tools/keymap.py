@@ -0,0 +1,213 @@
+#!/usr/bin/env python3
+"""Upload keymap layers and macros (src/keymap.c, src/macro.c)
+
+A keymap file has one line per remapped key:
+
+    LAYER KC ACTION      # comment
+
+LAYER is 0-7 and KC the key code in hex, as in src/layout.txt.  ACTION
+is a HID usage in hex, 'none', 'trans' (fall through to the layer
+below), 'mo(N)' (layer N while held), 'tg(N)' (toggle layer N),
+'m(N)' (play macro N), or one of the tap-hold actions 'mt(MOD,USAGE)'
+(modifier MOD, e0-e7, while held) and 'lt(N,USAGE)' (layer N while
+held), which send USAGE when tapped.  Keys which are not listed keep
+their usage from layout.txt on layer 0 and are transparent on the other
+layers.  Example, an Fn layer on the right GUI key with the arrows on
+IJKL:
+
+    0 4c mo(1)
+    1 34 52     # I: up
+    1 37 50     # J: left
+    1 39 51     # K: down
+    1 38 4f     # L: right
+
+Macros are lines of steps, played one report per USB frame:
+
+    macro N STEP...
+
+N is 0-31.  A STEP is a HID usage in hex to tap it, '+USAGE' to press,
+'-USAGE' to release, or e.g. '20ms' to wait.  Example, Fn+E types 'hi'
+and presses enter after a pause:
+
+    macro 0 0b 0c 100ms 28
+    1 08 m(0)
+
+Tap-hold keys are a hold once held for the tapping term, 200 ms unless
+set with 'tapping-term MS'.  'policy' followed by 'permissive-hold'
+(another key tapped meanwhile) and/or 'hold-on-other-key-press'
+decides on a hold sooner.  Example, control on a held caps lock:
+
+    0 03 mt(e0,39)
+    tapping-term 180
+    policy permissive-hold
+
+  keymap.py upload FILE      replace every layer and macro with those in FILE
+  keymap.py upload --clear   go back to layout.txt, without macros
+"""
+
+import argparse
+import re
+import struct
+import sys
+import time
+
+from vendor import write
+
+VID, PID = 0x24f0, 0x2020
+REQ_KEYMAP_WRITE = 0x04
+REQ_KEYMAP_COMMIT = 0x05
+REQ_MACRO_WRITE = 0x06
+REQ_MACRO_COMMIT = 0x07
+REQ_TAPHOLD = 0x08
+POLICIES = {'permissive-hold': 0x01, 'hold-on-other-key-press': 0x02}
+DEFAULT_TERM_MS = 200
+LAYERS = 8
+KEY_CODE_MAX = 0x8d
+LAYER_MAX = 2 * 252
+MACROS = 32
+MACRO_DATA_MAX = 4 * 252
+STEP_END, STEP_PRESS, STEP_RELEASE, STEP_TAP, STEP_DELAY = range(5)
+
+
+def action(word):
+    w = word.lower()
+    if w == 'none':
+        return 0x0000
+    if w == 'trans':
+        return 0xffff
+    m = re.fullmatch(r'(mo|tg)\((\d)\)', w)
+    if m:
+        layer = int(m.group(2))
+        if layer >= LAYERS:
+            raise ValueError('no layer %d' % layer)
+        return (0x1000 if m.group(1) == 'mo' else 0x2000) | layer
+    m = re.fullmatch(r'm\((\d+)\)', w)
+    if m:
+        n = int(m.group(1))
+        if n >= MACROS:
+            raise ValueError('no macro %d' % n)
+        return 0x3000 | n
+    m = re.fullmatch(r'(mt|lt)\(([0-9a-f]+),([0-9a-f]+)\)', w)
+    if m:
+        hold = int(m.group(2), 16)
+        if m.group(1) == 'mt':
+            if not 0xe0 <= hold <= 0xe7:
+                raise ValueError('modifier must be e0-e7')
+            return 0x4000 | (hold - 0xe0) << 8 | usage(m.group(3))
+        if hold >= LAYERS:
+            raise ValueError('no layer %d' % hold)
+        return 0x5000 | hold << 8 | usage(m.group(3))
+    return usage(w)
+
+
+def usage(word):
+    u = int(word, 16)
+    if not 0 < u <= 0xff:
+        raise ValueError('usage out of range')
+    return u
+
+
+def macro(words):
+    steps = bytearray()
+    held = set()
+    for w in words:
+        m = re.fullmatch(r'(\d+)ms', w.lower())
+        if m:
+            ms = int(m.group(1))
+            while ms > 0:
+                steps += bytes([STEP_DELAY, min(ms, 255)])
+                ms -= 255
+        elif w[0] == '+':
+            held.add(usage(w[1:]))
+            steps += bytes([STEP_PRESS, usage(w[1:])])
+        elif w[0] == '-':
+            held.discard(usage(w[1:]))
+            steps += bytes([STEP_RELEASE, usage(w[1:])])
+        else:
+            steps += bytes([STEP_TAP, usage(w)])
+    if held:
+        print('warning: macro leaves %s pressed' % ', '.join('%02x' % u for u in sorted(held)),
+              file=sys.stderr)
+    return bytes(steps) + bytes([STEP_END])
+
+
+def parse(text):
+    layers = [{} for _ in range(LAYERS)]
+    macros = {}
+    taphold = [DEFAULT_TERM_MS, 0]
+    for lineno, line in enumerate(text.splitlines(), 1):
+        words = line.split('#', 1)[0].split()
+        if not words:
+            continue
+        try:
+            if words[0].lower() == 'macro':
+                if len(words) < 2 or not 0 <= int(words[1]) < MACROS:
+                    raise ValueError('expected a macro number below %d' % MACROS)
+                macros[int(words[1])] = macro(words[2:])
+                continue
+            if words[0].lower() == 'tapping-term':
+                if len(words) != 2 or not 0 < int(words[1]) <= 0xffff:
+                    raise ValueError('expected a term in ms')
+                taphold[0] = int(words[1])
+                continue
+            if words[0].lower() == 'policy':
+                if not all(w.lower() in POLICIES for w in words[1:]):
+                    raise ValueError('policies are %s' % ', '.join(POLICIES))
+                taphold[1] = sum(POLICIES[w.lower()] for w in set(words[1:]))
+                continue
+            if len(words) != 3:
+                raise ValueError('expected LAYER KC ACTION')
+            layer, kc = int(words[0]), int(words[1], 16)
+            if not 0 <= layer < LAYERS or not 0 <= kc <= KEY_CODE_MAX:
+                raise ValueError('layer or key code out of range')
+            layers[layer][kc] = action(words[2])
+        except ValueError as e:
+            raise SystemExit('line %d: %s' % (lineno, e))
+    data = [b''.join(struct.pack('<BH', kc, a) for kc, a in sorted(l.items())) for l in layers]
+    for layer, d in enumerate(data):
+        if len(d) > LAYER_MAX:
+            raise SystemExit('layer %d has more than %d keys' % (layer, LAYER_MAX // 3))
+    # Macros are numbered by position, so fill any gaps with empty ones
+    count = max(macros) + 1 if macros else 0
+    steps = b''.join(macros.get(n, bytes([STEP_END])) for n in range(count))
+    if len(steps) > MACRO_DATA_MAX:
+        raise SystemExit('macros take %d bytes, maximum is %d' % (len(steps), MACRO_DATA_MAX))
+    return data, steps, taphold
+
+
+def upload(layers, macros, taphold):
+    import usb.core
+    dev = usb.core.find(idVendor=VID, idProduct=PID)
+    if dev is None:
+        sys.exit('keyboard not found')
+    start = time.monotonic()
+    for layer, data in enumerate(layers):
+        write(dev, REQ_KEYMAP_WRITE, data)
+        dev.ctrl_transfer(0x40, REQ_KEYMAP_COMMIT, len(data), layer, b'')
+    write(dev, REQ_MACRO_WRITE, macros)
+    dev.ctrl_transfer(0x40, REQ_MACRO_COMMIT, len(macros), 0, b'')
+    dev.ctrl_transfer(0x40, REQ_TAPHOLD, taphold[0], taphold[1], b'')
+    size = sum(map(len, layers)) + len(macros)
+    elapsed = time.monotonic() - start
+    print('%d bytes in %.0f ms, %.1f kB/s' % (size, elapsed * 1000, size / elapsed / 1000),
+          file=sys.stderr)
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split('\n')[0])
+    ap.add_argument('command', choices=('upload',))
+    ap.add_argument('file', nargs='?')
+    ap.add_argument('--clear', action='store_true', help='upload empty layers')
+    args = ap.parse_args()
+
+    if args.clear:
+        layers, macros, taphold = [b''] * LAYERS, b'', [DEFAULT_TERM_MS, 0]
+    elif args.file:
+        layers, macros, taphold = parse(open(args.file).read())
+    else:
+        ap.error('no keymap given')
+    upload(layers, macros, taphold)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,125 @@
+#!/usr/bin/env python3
+"""Generate the key and LED tables (layout.c) from src/layout.txt
+
+  layoutgen.py LAYOUT OUTPUT
+
+The tables are checked here, with errors reported against the line of
+the layout; the generated file adds static asserts tying them to
+LED_ID_MAX, KEY_CODE_MAX and LAYOUT_KEY_LEDS_MAX.
+"""
+
+import argparse
+import sys
+
+ORDERS = ('rgb', 'brg', 'gbr')
+KEY_LEDS_MAX = 4
+
+
+class LayoutError(Exception):
+    pass
+
+
+def parse(text):
+    """Returns (leds, keys): leds maps id to (x, y, order, comment) and
+    keys maps kc to (usage, [led ids], comment)"""
+    leds, keys = {}, {}
+    owner = {}
+    for lineno, line in enumerate(text.splitlines(), 1):
+        words, _, comment = line.partition('#')
+        words = words.split()
+        comment = comment.strip().replace('*/', '* /')
+        if not words:
+            continue
+        try:
+            def num(w):
+                v = int(w, 16)
+                if not 0 <= v <= 0xff:
+                    raise LayoutError('%r out of range' % w)
+                return v
+            if words[0] == 'led' and len(words) == 5:
+                id, x, y = map(num, words[1:4])
+                if id in leds:
+                    raise LayoutError('LED %02x listed twice' % id)
+                if words[4] not in ORDERS:
+                    raise LayoutError('unknown channel order %r' % words[4])
+                leds[id] = (x, y, ORDERS.index(words[4]), comment)
+            elif words[0] == 'key' and len(words) >= 3:
+                kc, usage = num(words[1]), num(words[2])
+                if kc in keys:
+                    raise LayoutError('key %02x listed twice' % kc)
+                if usage and any(k[0] == usage for k in keys.values()):
+                    raise LayoutError('usage %02x is already taken' % usage)
+                ids = []
+                for w in words[3:]:
+                    shared = w.startswith('+')
+                    id = num(w.lstrip('+'))
+                    if id not in leds:
+                        raise LayoutError('LED %02x is not listed' % id)
+                    if id in owner and not (shared and owner[id][1]):
+                        raise LayoutError('LED %02x also belongs to key %02x, mark both with +'
+                                          % (id, owner[id][0]))
+                    owner[id] = (kc, shared)
+                    ids.append(id)
+                if len(ids) > KEY_LEDS_MAX:
+                    raise LayoutError('more than %d LEDs' % KEY_LEDS_MAX)
+                keys[kc] = (usage, ids, comment)
+            else:
+                raise LayoutError('syntax error')
+        except (LayoutError, ValueError) as e:
+            raise LayoutError('line %d: %s' % (lineno, e))
+    missing = [id for id in range(max(leds, default=-1) + 1) if id not in leds]
+    if missing:
+        raise LayoutError('LED %02x is missing' % missing[0])
+    return leds, keys
+
+
+def led_offset(id):
+    """Index of the LED in each page sent to the drivers (src/led.c)"""
+    return ((id & 0xf) << 4) + (id >> 4) + 7
+
+
+def generate(leds, keys, source):
+    out = ['/* Generated by tools/layoutgen.py from %s, do not edit */' % source,
+           '#include <stdint.h>',
+           '#include <stdbool.h>',
+           '',
+           '#include "led.h"',
+           '#include "key.h"',
+           '#include "layout.h"',
+           '',
+           '_Static_assert(%d == LED_ID_MAX + 1, "every LED must be listed");' % len(leds),
+           '_Static_assert(0x%02x <= KEY_CODE_MAX, "key code beyond KEY_CODE_MAX");' % max(keys),
+           '_Static_assert(%d <= LAYOUT_KEY_LEDS_MAX, "too many LEDs on one key");'
+           % max(len(k[1]) for k in keys.values()),
+           '_Static_assert(sizeof(LAYOUT_LedTypeDef) == 4, "LED records are one word");',
+           '',
+           'const LAYOUT_LedTypeDef LAYOUT_Leds[LED_ID_MAX+1] = {']
+    for id, (x, y, order, comment) in sorted(leds.items()):
+        line = '\t[0x%02x] = { 0x%02x, LAYOUT_ORDER_%s, 0x%02x, 0x%02x },' % (
+            id, led_offset(id), ORDERS[order].upper(), x, y)
+        out.append(line + (' /* %s */' % comment if comment else ''))
+    out += ['};', '', 'const LAYOUT_KeyTypeDef LAYOUT_Keys[KEY_CODE_MAX+1] = {']
+    for kc, (usage, ids, comment) in sorted(keys.items()):
+        line = '\t[0x%02x] = { 0x%02x, %d, { %s } },' % (
+            kc, usage, len(ids), ', '.join('0x%02x' % id for id in ids) or '0')
+        out.append(line + (' /* %s */' % comment if comment else ''))
+    out += ['};', '']
+    return '\n'.join(out)
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split('\n')[0])
+    ap.add_argument('layout')
+    ap.add_argument('output')
+    args = ap.parse_args()
+
+    try:
+        leds, keys = parse(open(args.layout).read())
+    except LayoutError as e:
+        sys.exit('%s: %s' % (args.layout, e))
+    with open(args.output, 'w') as f:
+        f.write(generate(leds, keys, args.layout))
+
+
+if __name__ == '__main__':
+    main()
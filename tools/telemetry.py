@@ -0,0 +1,63 @@
+#!/usr/bin/env python3
+"""Print the keyboard's telemetry (USB_VENDOR_REQ_TELEMETRY, src/main.c)
+
+  telemetry.py            print once
+  telemetry.py -i SEC     print every SEC seconds until interrupted
+"""
+
+import argparse
+import struct
+import time
+
+VID, PID = 0x24f0, 0x2020
+REQ_TELEMETRY = 0x03
+CLOCK_LEVELS = ('full', 'idle')
+FORMAT = '<HHBBII%dIIHIH' % len(CLOCK_LEVELS)
+TIMER_MHZ = 84
+# Only in firmware built with IRQ_PROFILE=1, order of IRQ_SRC_* in src/irq.h
+IRQ_SOURCES = ('usb', 'scan', 'led', 'led dma', 'pendsv')
+
+
+def read(dev):
+    data = bytes(dev.ctrl_transfer(0xc0, REQ_TELEMETRY, 0, 0, 64))
+    fields = struct.unpack_from(FORMAT, data)
+    load, rate, fast, level, fast_ms, slow_ms = fields[:6]
+    info = {
+        'cpu load': '%.1f %%' % (load / 10),
+        'scan rate': '%d/s (%s)' % (rate, 'fast' if fast else 'slow'),
+        'scan residency': 'fast %d ms, slow %d ms' % (fast_ms, slow_ms),
+        'clock': '%s; ' % CLOCK_LEVELS[level] + ', '.join(
+            '%s %d ms' % (name, ms) for name, ms in zip(CLOCK_LEVELS, fields[6:-4])),
+        'macros': '%d reports, last at %d/s' % fields[-4:-2],
+        'capture drops': '%d records' % fields[-2],
+        'column settle': 'up to %.2f us' % (fields[-1] / TIMER_MHZ),
+    }
+    offs = struct.calcsize(FORMAT)
+    if len(data) > offs:
+        profile = struct.unpack_from('<%dI' % (len(IRQ_SOURCES) + 1), data, offs)
+        info['irq max cycles'] = ', '.join(
+            '%s %d' % (name, cycles) for name, cycles in zip(IRQ_SOURCES, profile))
+        info['led latency'] = '%d cycles' % profile[-1]
+    return info
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split('\n')[0])
+    ap.add_argument('-i', '--interval', type=float, help='repeat every INTERVAL seconds')
+    args = ap.parse_args()
+
+    import usb.core
+    dev = usb.core.find(idVendor=VID, idProduct=PID)
+    if dev is None:
+        raise SystemExit('keyboard not found')
+    while True:
+        for name, value in read(dev).items():
+            print('%-16s %s' % (name + ':', value))
+        if not args.interval:
+            break
+        print()
+        time.sleep(args.interval)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,88 @@
+#!/usr/bin/env python3
+"""Update the firmware over USB, keeping the settings (src/nvm.h)
+
+Restarts the keyboard into the ROM bootloader, as holding F12 at power
+on does, and flashes the two code regions with dfu-util, skipping
+sectors 2 and 3 between them so the settings and effect program
+survive.  The firmware region goes first and the region with the image
+header last: until both are written the checksum SystemInit verifies
+at boot does not match, so an update interrupted during the first
+download, or between the two, comes back up in the bootloader and can
+simply be run again.
+
+The second download rewrites sectors 0-1, which hold the vector table
+and SystemInit itself.  If it is interrupted while they are erased or
+partly written the keyboard no longer reaches the ROM bootloader by
+itself; it then has to be started with BOOT0 held high, or flashed over
+SWD.  That download is 32K at most and takes a few seconds.
+
+  update.py build/darkness.bin    flash this image, as made by make
+"""
+
+import argparse
+import os
+import subprocess
+import sys
+import tempfile
+import time
+
+import imagecrc
+
+VID, PID = 0x24f0, 0x2020
+DFU_VID, DFU_PID = 0x0483, 0xdf11
+REQ_DFU = 0x0f
+FLASH_BASE = 0x08000000
+DFU_TIMEOUT = 10
+
+
+def dfu_device():
+    import usb.core
+    return usb.core.find(idVendor=DFU_VID, idProduct=DFU_PID)
+
+
+def enter_dfu():
+    import usb.core
+    if dfu_device() is not None:
+        return
+    dev = usb.core.find(idVendor=VID, idProduct=PID)
+    if dev is None:
+        sys.exit('keyboard not found')
+    dev.ctrl_transfer(0x40, REQ_DFU, 0, 0, b'')
+    deadline = time.time() + DFU_TIMEOUT
+    while dfu_device() is None:
+        if time.time() > deadline:
+            sys.exit('keyboard did not enter DFU mode')
+        time.sleep(0.2)
+
+
+def dfu_download(data, address, leave=False):
+    with tempfile.NamedTemporaryFile(suffix='.bin', delete=False) as f:
+        f.write(data)
+    try:
+        subprocess.run(['dfu-util', '-d', '%04x:%04x' % (DFU_VID, DFU_PID), '-a', '0',
+                        '-s', '0x%08x%s' % (address, ':leave' if leave else ''),
+                        '-D', f.name], check=True)
+    except subprocess.CalledProcessError:
+        sys.exit('dfu-util failed; run again to retry')
+    finally:
+        os.unlink(f.name)
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split('\n')[0])
+    ap.add_argument('bin')
+    args = ap.parse_args()
+
+    image = open(args.bin, 'rb').read()
+    if not imagecrc.check(image):
+        sys.exit('%s: image header does not match, run tools/imagecrc.py on it' % args.bin)
+
+    start = time.time()
+    enter_dfu()
+    dfu_download(image[imagecrc.BASE:], FLASH_BASE + imagecrc.BASE)
+    dfu_download(image[:imagecrc.LOW_SIZE], FLASH_BASE, leave=True)
+    print('updated in %.1f s' % (time.time() - start))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,17 @@
+"""Vendor requests shared by the upload tools (USB_VendorOutCallback in src/main.c)
+
+Not run by itself; keymap.py, effectvm.py and analog.py import it.
+"""
+
+import struct
+import zlib
+
+DATA_MAX = 1024
+
+
+def write(dev, request, data):
+    """Send data in transfers of up to DATA_MAX bytes, each followed by
+    its CRC-32 for the keyboard to check"""
+    for offs in range(0, len(data), DATA_MAX):
+        chunk = data[offs:offs + DATA_MAX]
+        dev.ctrl_transfer(0x40, request, 0, offs, chunk + struct.pack('<I', zlib.crc32(chunk)))